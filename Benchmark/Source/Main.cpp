@@ -0,0 +1,172 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 24 Feb 2026 9:05:31pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "ProcessorBenchmark.h"
+#include "../../Source/PluginProcessor.h"
+
+namespace
+{
+    template <typename Type>
+    juce::Array<Type> parseList(const juce::String& text)
+    {
+        juce::Array<Type> values;
+
+        for (const auto& token : juce::StringArray::fromTokens(text, ",", {}))
+        {
+            if constexpr (std::is_integral_v<Type>)
+                values.add(token.getIntValue());
+            else
+                values.add(token.getDoubleValue());
+        }
+
+        return values;
+    }
+
+    void printUsage()
+    {
+        std::cout << "TeLeQBenchmark [opcoes]\n"
+                     "  --seconds <s>          audio medido por configuracao (padrao 1.0)\n"
+                     "  --channels <n>         canais do bus (padrao 2)\n"
+                     "  --block-sizes <a,b,..> tamanhos de buffer (padrao 16..4096)\n"
+                     "  --sample-rates <a,..>  sample rates (padrao 44100..192000)\n"
+                     "  --scenario <texto>     so os cenarios cujo nome contem o texto\n"
+                     "  --eq-engine <nome>     juce | tdf2 | svf (padrao: o do processor)\n"
+                     "  --null-test            residuo de tdf2 e svf contra juce em cada cenario\n"
+                     "  --json <arquivo|->     grava o resultado em JSON (- = stdout)\n"
+                     "  --editor-opens <n>     mede a abertura do editor (n frias + n com recursos compartilhados)\n"
+                     "\n"
+                     "Todo cenario roda sob a RealtimeGuard: alocacao no processBlock aparece na\n"
+                     "linha do cenario e o codigo de saida e 2.\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // O processor usa Timer (fila de notificações), então precisa do MessageManager
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h"))
+    {
+        printUsage();
+        return 0;
+    }
+
+    ProcessorBenchmark::Options options;
+
+    if (args.containsOption("--seconds"))
+        options.secondsPerRun = juce::jmax(0.01, args.getValueForOption("--seconds").getDoubleValue());
+    if (args.containsOption("--channels"))
+        options.numChannels = juce::jlimit(1, TeLeQAudioProcessor::maxNumChannels, args.getValueForOption("--channels").getIntValue());
+    if (args.containsOption("--block-sizes"))
+        options.blockSizes = parseList<int>(args.getValueForOption("--block-sizes"));
+    if (args.containsOption("--sample-rates"))
+        options.sampleRates = parseList<double>(args.getValueForOption("--sample-rates"));
+    if (args.containsOption("--scenario"))
+        options.scenarioFilter = args.getValueForOption("--scenario");
+
+    if (args.containsOption("--eq-engine"))
+    {
+        options.eqEngine = args.getValueForOption("--eq-engine");
+
+        if (!ProcessorBenchmark::getEqEngineNames().contains(options.eqEngine))
+        {
+            std::cerr << "--eq-engine desconhecido: " << options.eqEngine << std::endl;
+            printUsage();
+            return 1;
+        }
+    }
+
+    const int numEditorOpens = juce::jmax(0, args.getValueForOption("--editor-opens").getIntValue());
+
+    const auto jsonPath = args.getValueForOption("--json");
+    const bool jsonToStdout = jsonPath == "-";
+
+    // Tabela legível no stdout, a não ser que o JSON vá para lá
+    auto& table = jsonToStdout ? std::cerr : std::cout;
+
+    ProcessorBenchmark benchmark(options);
+
+    if (!ProcessorBenchmark::isAllocationGuardEnabled())
+        std::cerr << "Aviso: build sem TELEQ_RT_ALLOCATION_GUARD, alocacoes no audio thread nao sao verificadas" << std::endl;
+
+    int totalAllocations = 0;
+
+    const auto results = benchmark.run([&table, &totalAllocations](const ProcessorBenchmark::Result& result)
+    {
+        table << juce::String::formatted("%-28s %-4s %7.0f Hz %5d  %9.2f ns/sample %9.1f TSC ticks/sample  worst %9.1f us (%5.1f%%)",
+                                         result.scenario.toRawUTF8(), result.eqEngine.toRawUTF8(), result.sampleRate, result.blockSize,
+                                         result.nsPerSample, result.tscTicksPerSample,
+                                         result.worstBlockMicroseconds, result.worstBlockLoad * 100.0);
+
+        if (result.audioThreadAllocations > 0)
+            table << juce::String::formatted("  ALLOCATIONS %d", result.audioThreadAllocations);
+
+        table << std::endl;
+        totalAllocations += result.audioThreadAllocations;
+    });
+
+    auto jsonRoot = benchmark.toJson(results);
+
+    if (args.containsOption("--null-test"))
+    {
+        const auto nullTests = benchmark.runNullTests();
+
+        for (const auto& nullTest : nullTests)
+            table << juce::String::formatted("null %-28s %-4s vs juce  peak %7.1f dBFS  rms %7.1f dBFS",
+                                             nullTest.scenario.toRawUTF8(), nullTest.eqEngine.toRawUTF8(),
+                                             nullTest.peakResidualDb, nullTest.rmsResidualDb)
+                  << std::endl;
+
+        if (auto* root = jsonRoot.getDynamicObject())
+            root->setProperty("nullTests", ProcessorBenchmark::toJson(nullTests));
+    }
+
+    if (numEditorOpens > 0)
+    {
+        const auto editorOpen = ProcessorBenchmark::measureEditorOpen(numEditorOpens);
+
+        table << juce::String::formatted("editor open: cold %.2f ms, shared assets %.2f ms (mean of %d each)",
+                                         editorOpen.meanColdOpenMilliseconds, editorOpen.meanSharedOpenMilliseconds,
+                                         editorOpen.numOpens)
+              << std::endl;
+
+        auto editorJson = std::make_unique<juce::DynamicObject>();
+        editorJson->setProperty("meanColdOpenMilliseconds", editorOpen.meanColdOpenMilliseconds);
+        editorJson->setProperty("meanSharedOpenMilliseconds", editorOpen.meanSharedOpenMilliseconds);
+        editorJson->setProperty("numOpens", editorOpen.numOpens);
+
+        if (auto* root = jsonRoot.getDynamicObject())
+            root->setProperty("editorOpen", juce::var(editorJson.release()));
+    }
+
+    if (jsonPath.isNotEmpty())
+    {
+        const auto json = juce::JSON::toString(jsonRoot);
+
+        if (jsonToStdout)
+            std::cout << json << std::endl;
+        else if (!juce::File::getCurrentWorkingDirectory().getChildFile(jsonPath).replaceWithText(json))
+        {
+            std::cerr << "Nao foi possivel gravar " << jsonPath << std::endl;
+            return 1;
+        }
+    }
+
+    if (totalAllocations > 0)
+    {
+        std::cerr << totalAllocations << " alocacoes no audio thread (ver os cenarios marcados)" << std::endl;
+        return 2;
+    }
+
+    return 0;
+}
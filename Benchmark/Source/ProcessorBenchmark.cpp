@@ -0,0 +1,421 @@
+/*
+  ==============================================================================
+
+    ProcessorBenchmark.cpp
+    Created: 24 Feb 2026 9:05:31pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "ProcessorBenchmark.h"
+#include "../../Source/PluginProcessor.h"
+#include "../../Source/EditorAssets.h"
+#include "../../Source/RealtimeGuard.h"
+
+#if JUCE_INTEL
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <x86intrin.h>
+ #endif
+#endif
+
+namespace
+{
+    constexpr double warmUpSeconds = 0.25;
+    constexpr float signalLevel = 0.25f; // ~ -12 dBFS
+
+    bool hasTsc() noexcept
+    {
+       #if JUCE_INTEL
+        return true;
+       #else
+        return false;
+       #endif
+    }
+
+    juce::uint64 readTsc() noexcept
+    {
+       #if JUCE_INTEL
+        return (juce::uint64)__rdtsc();
+       #else
+        return 0;
+       #endif
+    }
+
+    void applyScenario(TeLeQAudioProcessor& processor, const ProcessorBenchmark::Scenario& scenario)
+    {
+        for (const auto& [parameterId, value] : scenario.parameters)
+        {
+            auto* parameter = processor.apvts.getParameter(parameterId);
+            jassert(parameter != nullptr);
+
+            if (parameter != nullptr)
+                parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+        }
+    }
+
+    // Nome desconhecido (ou vazio) mantém o engine padrão do processor
+    void applyEqEngine(TeLeQAudioProcessor& processor, const juce::String& name)
+    {
+        const int index = ProcessorBenchmark::getEqEngineNames().indexOf(name);
+
+        if (index >= 0)
+            processor.setEqEngine((TeLeQAudioProcessor::EqEngine)index);
+    }
+
+    // Ruído com semente fixa: o mesmo sinal em toda rodada e em todo engine
+    template <typename SampleType>
+    juce::AudioBuffer<SampleType> makeNoise(int numChannels, int length)
+    {
+        juce::AudioBuffer<SampleType> noise(numChannels, length);
+        juce::Random random(0x7e1e);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int i = 0; i < length; ++i)
+                noise.setSample(ch, i, (SampleType)((random.nextFloat() * 2.0f - 1.0f) * signalLevel));
+
+        return noise;
+    }
+}
+
+ProcessorBenchmark::ProcessorBenchmark(Options optionsToUse)
+    : options(std::move(optionsToUse))
+{
+}
+
+std::vector<ProcessorBenchmark::Scenario> ProcessorBenchmark::createScenarios()
+{
+    // EQ com todas as bandas fora de 0 dB (nenhum estágio é pulado) e cortes ligados
+    auto eqWithSlope = [](const juce::String& name, float slope) -> Scenario
+    {
+        return { name, { { "HPFFreq", 80.0f }, { "LPFFreq", 12000.0f },
+                         { "HPF_Slope", slope }, { "LPF_Slope", slope },
+                         { "LowGain", 3.0f }, { "LowMidGain", -2.0f },
+                         { "HighMidGain", 2.0f }, { "HighGain", -3.0f } } };
+    };
+
+    // Mesmo cenário com parâmetros (de configuração) a mais
+    auto with = [](Scenario scenario, const juce::String& name, std::vector<std::pair<juce::String, float>> extra)
+    {
+        scenario.name = name;
+        scenario.parameters.insert(scenario.parameters.end(), extra.begin(), extra.end());
+        return scenario;
+    };
+
+    const auto eq = eqWithSlope("eq_24dB", 1.0f);
+    const Scenario driveTape{ "drive_tape", { { "DriveAmount", 0.6f }, { "DriveType", 0.0f } } };
+    const Scenario telefyDistort{ "telefy_distort", { { "TelefyAmount", 0.7f }, { "DistortionType", 0.0f } } };
+
+    auto eqJuce = with(eq, "eq_24dB_juce", {});
+    eqJuce.eqEngine = "juce";
+    auto eqSvf = with(eq, "eq_24dB_svf", {});
+    eqSvf.eqEngine = "svf";
+
+    // Oversampling: índice = factorLog2; filtro 0 = IIR, 1 = FIR
+    auto driveOffline = with(driveTape, "drive_tape_offline8x", { { "OfflineOversampling", 1.0f } });
+    driveOffline.nonRealtime = true;
+
+    return {
+        { "neutral", {} },
+        eqWithSlope("eq_12dB", 0.0f),
+        eq,
+        eqJuce,
+        eqSvf,
+        with(eq, "eq_linear_phase", { { "LinearPhase", 1.0f } }),
+        with(eq, "eq_linear_phase_32k_uniform", { { "LinearPhase", 1.0f }, { "LinearPhaseLength", 3.0f },
+                                                  { "LinearPhasePartitioning", 0.0f } }),
+        driveTape,
+        { "drive_tube", { { "DriveAmount", 0.6f }, { "DriveType", 1.0f } } },
+        { "drive_fet",  { { "DriveAmount", 0.6f }, { "DriveType", 2.0f } } },
+        with(driveTape, "drive_tape_os2x_iir", { { "Oversampling", 1.0f } }),
+        with(driveTape, "drive_tape_os8x_fir", { { "Oversampling", 3.0f }, { "OversamplingFilter", 1.0f } }),
+        driveOffline,
+        with(driveTape, "drive_tape_fast", { { "SaturationMode", 1.0f } }),
+        with(driveTape, "drive_tape_kweighted", { { "AutoGainMode", 1.0f } }),
+        telefyDistort,
+        { "telefy_obliterate", { { "TelefyAmount", 0.7f }, { "DistortionType", 1.0f } } },
+        with(telefyDistort, "telefy_distort_os4x", { { "Oversampling", 2.0f } }),
+        with(telefyDistort, "telefy_distort_fast", { { "SaturationMode", 1.0f } }),
+        with(telefyDistort, "telefy_distort_kweighted", { { "AutoGainMode", 1.0f } })
+    };
+}
+
+std::vector<ProcessorBenchmark::Result> ProcessorBenchmark::run(const std::function<void(const Result&)>& onResult)
+{
+    std::vector<Result> results;
+
+    for (const auto& scenario : createScenarios())
+    {
+        if (options.scenarioFilter.isNotEmpty() && !scenario.name.contains(options.scenarioFilter))
+            continue;
+
+        for (auto sampleRate : options.sampleRates)
+        {
+            for (auto blockSize : options.blockSizes)
+            {
+                results.push_back(measure(scenario, sampleRate, blockSize));
+
+                if (onResult)
+                    onResult(results.back());
+            }
+        }
+    }
+
+    return results;
+}
+
+ProcessorBenchmark::Result ProcessorBenchmark::measure(const Scenario& scenario, double sampleRate, int blockSize)
+{
+    // Instância nova por configuração: nenhum estado herdado da anterior
+    TeLeQAudioProcessor processor;
+    applyScenario(processor, scenario);
+    applyEqEngine(processor, scenario.eqEngine.isNotEmpty() ? scenario.eqEngine : options.eqEngine);
+    processor.setNonRealtime(scenario.nonRealtime);
+
+    // Parâmetros antes do prepareToPlay: as rampas já partem dos valores finais
+    processor.setPlayConfigDetails(options.numChannels, options.numChannels, sampleRate, blockSize);
+    processor.prepareToPlay(sampleRate, blockSize);
+
+    // Um segundo de ruído com semente fixa, repetido em loop (mesmo sinal em toda rodada)
+    const int sourceLength = juce::jmax(blockSize, juce::roundToInt(sampleRate));
+    const auto source = makeNoise<float>(options.numChannels, sourceLength);
+
+    juce::AudioBuffer<float> buffer(options.numChannels, blockSize);
+    juce::MidiBuffer midi;
+    int sourcePosition = 0;
+
+    auto processNextBlock = [&]
+    {
+        if (sourcePosition + blockSize > sourceLength)
+            sourcePosition = 0;
+
+        for (int ch = 0; ch < options.numChannels; ++ch)
+            buffer.copyFrom(ch, 0, source, ch, sourcePosition, blockSize);
+
+        sourcePosition += blockSize;
+
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        const auto startTsc = readTsc();
+
+        processor.processBlock(buffer, midi);
+
+        return std::make_pair(juce::Time::getHighResolutionTicks() - startTicks,
+                              readTsc() - startTsc);
+    };
+
+    // Todo processBlock (aquecimento incluso) roda dentro do ScopedNoAllocation do processor
+    const int violationsBefore = RealtimeGuard::getNumViolations();
+
+    const int numWarmUpBlocks = juce::jmax(1, juce::roundToInt(warmUpSeconds * sampleRate / blockSize));
+    const int numBlocks = juce::jmax(1, juce::roundToInt(options.secondsPerRun * sampleRate / blockSize));
+
+    for (int block = 0; block < numWarmUpBlocks; ++block)
+        processNextBlock();
+
+    juce::int64 totalTicks = 0, worstTicks = 0;
+    juce::uint64 totalTsc = 0;
+
+    for (int block = 0; block < numBlocks; ++block)
+    {
+        const auto [ticks, tscTicks] = processNextBlock();
+        totalTicks += ticks;
+        totalTsc += tscTicks;
+        worstTicks = juce::jmax(worstTicks, ticks);
+    }
+
+    const int violations = RealtimeGuard::getNumViolations() - violationsBefore;
+    processor.releaseResources();
+
+    const double totalSamples = (double)numBlocks * blockSize;
+    const double totalSeconds = juce::Time::highResolutionTicksToSeconds(totalTicks);
+    const double worstSeconds = juce::Time::highResolutionTicksToSeconds(worstTicks);
+
+    Result result;
+    result.scenario = scenario.name;
+    result.eqEngine = getEqEngineNames()[(int)processor.getEqEngine()];
+    result.sampleRate = sampleRate;
+    result.blockSize = blockSize;
+    result.numChannels = options.numChannels;
+    result.latencySamples = processor.getLatencySamples();
+    result.nsPerSample = totalSeconds * 1.0e9 / totalSamples;
+    result.worstBlockMicroseconds = worstSeconds * 1.0e6;
+    result.worstBlockLoad = worstSeconds / (blockSize / sampleRate);
+    result.audioThreadAllocations = violations;
+
+    // Sem TSC: estimativa pelo clock nominal da CPU (a mesma escala do TSC)
+    result.tscTicksPerSample = hasTsc()
+        ? (double)totalTsc / totalSamples
+        : result.nsPerSample * juce::SystemStats::getCpuSpeedInMegahertz() * 1.0e-3;
+
+    return result;
+}
+
+ProcessorBenchmark::EditorOpenResult ProcessorBenchmark::measureEditorOpen(int numOpens)
+{
+    TeLeQAudioProcessor processor;
+    EditorOpenResult result;
+
+    // Abre e fecha em sequência: nunca há dois editores (dois leitores do
+    // analisador) ao mesmo tempo; só a abertura entra no tempo
+    auto measureOpens = [&processor, numOpens]
+    {
+        double totalMilliseconds = 0.0;
+
+        for (int i = 0; i < numOpens; ++i)
+        {
+            const auto startTicks = juce::Time::getHighResolutionTicks();
+            std::unique_ptr<juce::AudioProcessorEditor> editor(processor.createEditor());
+            totalMilliseconds += juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks) * 1.0e3;
+        }
+
+        return numOpens > 0 ? totalMilliseconds / numOpens : 0.0;
+    };
+
+    result.numOpens = numOpens;
+    result.meanColdOpenMilliseconds = measureOpens();
+
+    {
+        const juce::SharedResourcePointer<EditorAssets> otherInstance;
+        result.meanSharedOpenMilliseconds = measureOpens();
+    }
+
+    return result;
+}
+
+std::vector<ProcessorBenchmark::NullTestResult> ProcessorBenchmark::runNullTests() const
+{
+    constexpr int blockSize = 512;
+    const double sampleRate = options.sampleRates.isEmpty() ? 48000.0 : options.sampleRates.getFirst();
+    const int length = juce::roundToInt(sampleRate);
+    const auto input = makeNoise<double>(options.numChannels, length);
+    const auto engineNames = getEqEngineNames();
+
+    // Um segundo em precisão dupla (sem a conversão float do host), instância nova por engine
+    auto render = [&](const Scenario& scenario, int engine)
+    {
+        TeLeQAudioProcessor processor;
+        applyScenario(processor, scenario);
+        applyEqEngine(processor, engineNames[engine]);
+        processor.setNonRealtime(scenario.nonRealtime);
+
+        processor.setPlayConfigDetails(options.numChannels, options.numChannels, sampleRate, blockSize);
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        juce::AudioBuffer<double> output(input);
+        juce::MidiBuffer midi;
+
+        for (int start = 0; start < length; start += blockSize)
+        {
+            juce::AudioBuffer<double> block(output.getArrayOfWritePointers(), output.getNumChannels(),
+                                            start, juce::jmin(blockSize, length - start));
+            processor.processBlock(block, midi);
+        }
+
+        processor.releaseResources();
+        return output;
+    };
+
+    std::vector<NullTestResult> results;
+
+    for (const auto& scenario : createScenarios())
+    {
+        if (options.scenarioFilter.isNotEmpty() && !scenario.name.contains(options.scenarioFilter))
+            continue;
+
+        const auto reference = render(scenario, 0);
+
+        for (int engine = 1; engine < engineNames.size(); ++engine)
+        {
+            const auto output = render(scenario, engine);
+            double peak = 0.0, sumOfSquares = 0.0;
+
+            for (int ch = 0; ch < options.numChannels; ++ch)
+            {
+                const auto* a = reference.getReadPointer(ch);
+                const auto* b = output.getReadPointer(ch);
+
+                for (int i = 0; i < length; ++i)
+                {
+                    const double difference = b[i] - a[i];
+                    peak = juce::jmax(peak, std::abs(difference));
+                    sumOfSquares += difference * difference;
+                }
+            }
+
+            NullTestResult result;
+            result.scenario = scenario.name;
+            result.eqEngine = engineNames[engine];
+            result.sampleRate = sampleRate;
+            result.peakResidualDb = juce::Decibels::gainToDecibels(peak, -300.0);
+            result.rmsResidualDb = juce::Decibels::gainToDecibels(std::sqrt(sumOfSquares / ((double)length * options.numChannels)), -300.0);
+            results.push_back(result);
+        }
+    }
+
+    return results;
+}
+
+bool ProcessorBenchmark::isAllocationGuardEnabled() noexcept
+{
+    return TELEQ_RT_ALLOCATION_GUARD != 0;
+}
+
+juce::String ProcessorBenchmark::getTickSource()
+{
+    return hasTsc() ? "rdtsc" : "nominal-clock";
+}
+
+juce::var ProcessorBenchmark::toJson(const std::vector<Result>& results) const
+{
+    juce::Array<juce::var> runs;
+
+    for (const auto& result : results)
+    {
+        auto run = std::make_unique<juce::DynamicObject>();
+        run->setProperty("scenario", result.scenario);
+        run->setProperty("eqEngine", result.eqEngine);
+        run->setProperty("sampleRate", result.sampleRate);
+        run->setProperty("blockSize", result.blockSize);
+        run->setProperty("numChannels", result.numChannels);
+        run->setProperty("latencySamples", result.latencySamples);
+        run->setProperty("nsPerSample", result.nsPerSample);
+        run->setProperty("tscTicksPerSample", result.tscTicksPerSample);
+        run->setProperty("worstBlockMicroseconds", result.worstBlockMicroseconds);
+        run->setProperty("worstBlockLoad", result.worstBlockLoad);
+        run->setProperty("audioThreadAllocations", result.audioThreadAllocations);
+        runs.add(juce::var(run.release()));
+    }
+
+    auto root = std::make_unique<juce::DynamicObject>();
+    root->setProperty("plugin", "TeLeQ");
+    root->setProperty("cpu", juce::SystemStats::getCpuModel());
+    root->setProperty("cpuMHz", juce::SystemStats::getCpuSpeedInMegahertz());
+    root->setProperty("os", juce::SystemStats::getOperatingSystemName());
+    root->setProperty("tickSource", getTickSource());
+    root->setProperty("allocationGuard", isAllocationGuardEnabled());
+    root->setProperty("secondsPerRun", options.secondsPerRun);
+    root->setProperty("runs", runs);
+
+    return juce::var(root.release());
+}
+
+juce::var ProcessorBenchmark::toJson(const std::vector<NullTestResult>& nullTests)
+{
+    juce::Array<juce::var> entries;
+
+    for (const auto& result : nullTests)
+    {
+        auto entry = std::make_unique<juce::DynamicObject>();
+        entry->setProperty("scenario", result.scenario);
+        entry->setProperty("eqEngine", result.eqEngine);
+        entry->setProperty("reference", getEqEngineNames()[0]);
+        entry->setProperty("sampleRate", result.sampleRate);
+        entry->setProperty("peakResidualDb", result.peakResidualDb);
+        entry->setProperty("rmsResidualDb", result.rmsResidualDb);
+        entries.add(juce::var(entry.release()));
+    }
+
+    return entries;
+}
@@ -0,0 +1,112 @@
+/*
+  ==============================================================================
+
+    ProcessorBenchmark.h
+    Created: 24 Feb 2026 9:05:31pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// Mede o custo do TeLeQAudioProcessor fora do DAW (sem editor e sem host):
+// varre cenários (tipos de Drive, modos do Telefy, slopes do HPF/LPF, engines
+// do EQ, fase linear, oversampling e os modos do saturador e do auto-gain),
+// tamanhos de buffer e sample rates, e reporta ns/amostra, ticks de TSC/amostra
+// e o pior bloco de cada configuração. À parte, mede o tempo de abrir o editor e o
+// resíduo do null test entre as implementações do EQ.
+class ProcessorBenchmark
+{
+public:
+    struct Options
+    {
+        double secondsPerRun = 1.0;
+        int numChannels = 2;
+        juce::Array<int> blockSizes{ 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+        juce::Array<double> sampleRates{ 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 };
+        juce::String scenarioFilter; // vazio = todos; senão só os cenários cujo nome contém o texto
+        juce::String eqEngine;       // um de getEqEngineNames(); vazio = padrão do processor
+    };
+
+    // Nomes do --eq-engine, na ordem de TeLeQAudioProcessor::EqEngine
+    static juce::StringArray getEqEngineNames() { return { "juce", "tdf2", "svf" }; }
+
+    // Valores dos parâmetros (unidades do APVTS) aplicados antes do prepareToPlay;
+    // a configuração (oversampling, fase linear, modos) é aplicada pelo próprio prepare
+    struct Scenario
+    {
+        juce::String name;
+        std::vector<std::pair<juce::String, float>> parameters;
+        juce::String eqEngine;    // vazio = o do --eq-engine
+        bool nonRealtime = false; // render offline (setNonRealtime)
+    };
+
+    struct Result
+    {
+        juce::String scenario;
+        juce::String eqEngine;
+        double sampleRate = 0.0;
+        int blockSize = 0;
+        int numChannels = 0;
+        int latencySamples = 0;
+        double nsPerSample = 0.0;            // por frame (todos os canais)
+        double tscTicksPerSample = 0.0;      // TSC a clock constante, não ciclos do núcleo
+        double worstBlockMicroseconds = 0.0;
+        double worstBlockLoad = 0.0;         // pior bloco / duração do bloco em tempo real
+        int audioThreadAllocations = 0;      // pegas pela RealtimeGuard no processBlock
+    };
+
+    // A RealtimeGuard está compilada (o .jucer do benchmark a liga em todas as configurações)
+    static bool isAllocationGuardEnabled() noexcept;
+
+    explicit ProcessorBenchmark(Options optionsToUse);
+
+    static std::vector<Scenario> createScenarios();
+
+    // Roda a varredura inteira; onResult é chamado a cada configuração medida
+    std::vector<Result> run(const std::function<void(const Result&)>& onResult = {});
+
+    juce::var toJson(const std::vector<Result>& results) const;
+
+    // Abertura do editor, um de cada vez (cada editor tem o seu leitor dos
+    // SpectrumTap, que só aceitam um). "Frio": nenhum EditorAssets vivo, cada
+    // abertura decodifica tudo (o custo de toda abertura antes do compartilhamento).
+    // "Compartilhado": outra instância mantém o EditorAssets vivo, como num mixer
+    // com vários TeLeQ.
+    struct EditorOpenResult
+    {
+        double meanColdOpenMilliseconds = 0.0;
+        double meanSharedOpenMilliseconds = 0.0;
+        int numOpens = 0;
+    };
+
+    static EditorOpenResult measureEditorOpen(int numOpens);
+
+    // Null test (A/B) do EQ: o mesmo ruído por cada cenário em cada engine, contra o
+    // MonoChain ("juce") como referência. Resíduo em dBFS (pico e RMS da diferença),
+    // no primeiro sample rate das opções.
+    struct NullTestResult
+    {
+        juce::String scenario;
+        juce::String eqEngine;
+        double sampleRate = 0.0;
+        double peakResidualDb = 0.0;
+        double rmsResidualDb = 0.0;
+    };
+
+    std::vector<NullTestResult> runNullTests() const;
+    static juce::var toJson(const std::vector<NullTestResult>& nullTests);
+
+    // "rdtsc" quando há TSC (clock nominal constante: não acompanha turbo nem
+    // frequência reduzida), senão "nominal-clock" (tempo x clock nominal)
+    static juce::String getTickSource();
+
+private:
+    Result measure(const Scenario& scenario, double sampleRate, int blockSize);
+
+    Options options;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ProcessorBenchmark)
+};
@@ -0,0 +1,126 @@
+/*
+  ==============================================================================
+
+    AutoGain.h
+    Created: 9 Mar 2026 10:04:22pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <cmath>
+#include "BiquadDesign.h"
+#include "FixedBiquadCascade.h"
+
+// Auto-gain em taxa de controle: a energia de entrada/saída é acumulada por
+// trechos de controlInterval amostras, o ganho alvo é calculado uma vez por
+// trecho e aplicado com rampa linear por amostra. Mesma constante de tempo do
+// antigo AutoGainRMS por amostra (0.005).
+class AutoGain
+{
+public:
+    enum class Mode
+    {
+        Rms,        // energia bruta
+        KWeighted   // energia pós-filtro K (BS.1770), mais perto da loudness percebida
+    };
+
+    static constexpr int controlInterval = 32;
+
+    void prepare(double sampleRate)
+    {
+        logDecayPerSample = std::log(1.0 - smoothing);
+
+        for (auto* weighting : { &inputWeighting, &outputWeighting })
+        {
+            weighting->setCoefficients(0, BiquadDesign::kWeightingShelf(sampleRate));
+            weighting->setCoefficients(1, BiquadDesign::kWeightingHighPass(sampleRate));
+        }
+
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        meanSquareIn = 1e-12;
+        meanSquareOut = 1e-12;
+        gain = 1.0;
+        inputWeighting.reset();
+        outputWeighting.reset();
+    }
+
+    // destination[i] = output[i] * ganho. destination pode ser o próprio input:
+    // cada trecho é medido antes de ser escrito.
+    void process(const double* input, const double* output, double* destination, int numSamples, Mode mode) noexcept
+    {
+        for (int start = 0; start < numSamples; start += controlInterval)
+        {
+            const int length = juce::jmin(controlInterval, numSamples - start);
+
+            double energyIn, energyOut;
+
+            if (mode == Mode::KWeighted)
+            {
+                double weightedIn[controlInterval], weightedOut[controlInterval];
+                std::copy(input + start, input + start + length, weightedIn);
+                std::copy(output + start, output + start + length, weightedOut);
+
+                inputWeighting.process(weightedIn, length, FilterTopology::Tdf2);
+                outputWeighting.process(weightedOut, length, FilterTopology::Tdf2);
+
+                energyIn = sumOfSquares(weightedIn, length);
+                energyOut = sumOfSquares(weightedOut, length);
+            }
+            else
+            {
+                energyIn = sumOfSquares(input + start, length);
+                energyOut = sumOfSquares(output + start, length);
+            }
+
+            // Média exponencial equivalente a 'length' passos por amostra
+            const double decay = std::exp(logDecayPerSample * length);
+            meanSquareIn = decay * meanSquareIn + (1.0 - decay) * energyIn / length;
+            meanSquareOut = decay * meanSquareOut + (1.0 - decay) * energyOut / length;
+
+            const double target = (meanSquareOut > 1e-12 ? std::sqrt(meanSquareIn / meanSquareOut) : 1.0);
+            const double endGain = target + (gain - target) * decay;
+
+            // rampa linear do ganho atual até o do fim do trecho
+            const double step = (endGain - gain) / length;
+            const double startGain = gain;
+
+            for (int i = 0; i < length; ++i)
+                destination[start + i] = output[start + i] * (startGain + step * (i + 1));
+
+            gain = endGain;
+        }
+    }
+
+private:
+    // 4 acumuladores independentes: sem dependência serial, o compilador usa SIMD
+    static double sumOfSquares(const double* data, int numSamples) noexcept
+    {
+        double acc[4] = {};
+        int i = 0;
+
+        for (; i + 4 <= numSamples; i += 4)
+            for (int lane = 0; lane < 4; ++lane)
+                acc[lane] += data[i + lane] * data[i + lane];
+
+        for (; i < numSamples; ++i)
+            acc[0] += data[i] * data[i];
+
+        return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+    }
+
+    double smoothing = 0.005;
+    double logDecayPerSample = std::log(1.0 - 0.005);
+
+    double meanSquareIn = 1e-12;
+    double meanSquareOut = 1e-12;
+    double gain = 1.0;
+
+    FixedBiquadCascade<2> inputWeighting, outputWeighting;
+};
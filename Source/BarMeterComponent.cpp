@@ -15,52 +15,106 @@ BarMeterComponent::BarMeterComponent()
 void BarMeterComponent::paint(juce::Graphics& g)
 {
     auto bounds = getLocalBounds().toFloat();
+    const int width = getWidth();
+    const int height = getHeight();
 
     // 1. BACKGROUND SUTIL (cinzento muito escuro com baixa opacidade)
     g.setColour(juce::Colour(0x501a1a1a));
     g.fillRect(bounds);
 
-    // 2. CALCULAR ALTURA DO MEDIDOR
-    float meterHeight = bounds.getHeight() * this->peak;
+    // 2. BARRA DE PICO: recorte da coluna de gradiente (verde embaixo → vermelho em cima)
+    // A cor muda de acordo com a ALTURA da barra, não com o nível
+    if (peakY < height && gradientStrip.isValid())
+        g.drawImage(gradientStrip, 0, peakY, width, height - peakY, 0, peakY, 1, height - peakY);
 
-    // 3. CALCULAR O TOPO DO MEDIDOR (crescer de baixo para cima)
-    float startY = bounds.getBottom() - meterHeight;
+    // 3. RMS (escurece a parte da barra abaixo do nível médio) E PEAK-HOLD
+    const int rmsTop = juce::jmax(rmsY, peakY);
+    if (rmsTop < height)
+    {
+        g.setColour(juce::Colour(0x40000000));
+        g.fillRect(0, rmsTop, width, height - rmsTop);
+    }
 
-    // 4. DEFINIR A ÁREA DE PREENCHIMENTO
-    juce::Rectangle<float> meterArea(
-        bounds.getX(),
-        startY,
-        bounds.getWidth(),
-        meterHeight
-    );
+    if (holdY < height)
+    {
+        g.setColour(juce::Colour(0xFFecf0f1));
+        g.fillRect(0, juce::jmax(0, holdY - 1), width, 2);
+    }
 
-    // 5. DESENHAR GRADIENTE VERTICAL (verde embaixo → vermelho em cima)
-    // A cor muda de acordo com a ALTURA da barra, não com o nível
-    juce::ColourGradient gradient(
+    // 4. BORDA SUTIL (muito discreta)
+    g.setColour(juce::Colour(0x802a2a2a));
+    g.drawRect(bounds, 0.7f);  // Linha muito fina (0.5px)
+}
+
+void BarMeterComponent::resized()
+{
+    peakY = rmsY = holdY = getHeight();
+    updateGradientStrip();
+}
+
+void BarMeterComponent::updateGradientStrip()
+{
+    const int height = getHeight();
+
+    if (height <= 0)
+    {
+        gradientStrip = {};
+        return;
+    }
+
+    gradientStrip = juce::Image(juce::Image::ARGB, 1, height, false);
+    juce::Graphics g(gradientStrip);
+
+    g.setGradientFill(juce::ColourGradient(
         juce::Colour(0xFFe74c3c),  // Vermelho no topo (clipping)
-        bounds.getX(),
-        bounds.getY(),
+        0.0f,
+        0.0f,
         juce::Colour(0xFF2ecc71),  // Verde na base
-        bounds.getX(),
-        bounds.getBottom(),
+        0.0f,
+        (float)height,
         false
-    );
-    g.setGradientFill(gradient);
-    g.fillRect(meterArea);
+    ));
+    g.fillAll();
+}
 
-    // 7. BORDA SUTIL (muito discreta)
-    g.setColour(juce::Colour(0x802a2a2a));
-    g.drawRect(bounds, 0.7f);  // Linha muito fina (0.5px)
+int BarMeterComponent::levelToY(float level) const noexcept
+{
+    const int height = getHeight();
+    return height - juce::roundToInt(juce::jlimit(0.0f, 1.0f, level) * (float)height);
 }
 
-void BarMeterComponent::update(float newPeakValue)
+void BarMeterComponent::update(float newPeakValue, float newRmsValue, float newHoldValue)
 {
-    DBG("BarMeterComponent - Valor Bruto Recebido: " << newPeakValue);
+    const int newPeakY = levelToY(newPeakValue);
+    const int newRmsY = levelToY(newRmsValue);
+    const int newHoldY = juce::jmin(levelToY(newHoldValue), newPeakY);
+
+    if (newPeakY == peakY && newRmsY == rmsY && newHoldY == holdY)
+        return;
 
-    // Limita o valor entre 0.0 e 1.0
-    peak = juce::jlimit(0.0f, 1.0f, newPeakValue);
-    DBG("Meter value: " << peak);
+    // Faixa suja: entre a posição antiga e a nova de cada elemento que mudou
+    // (a linha de hold ocupa 2 px acima do topo)
+    juce::Range<int> dirty;
 
-    // Força o JUCE a redesenhar o componente
-    repaint();
-}
\ No newline at end of file
+    auto addSpan = [&dirty](int oldY, int newY, int extraAbove)
+    {
+        if (oldY == newY)
+            return;
+
+        const auto span = juce::Range<int>(juce::jmin(oldY, newY) - extraAbove, juce::jmax(oldY, newY) + 1);
+        dirty = dirty.isEmpty() ? span : dirty.getUnionWith(span);
+    };
+
+    addSpan(peakY, newPeakY, 0);
+    addSpan(juce::jmax(rmsY, peakY), juce::jmax(newRmsY, newPeakY), 0);
+    addSpan(holdY, newHoldY, 2);
+
+    peakY = newPeakY;
+    rmsY = newRmsY;
+    holdY = newHoldY;
+
+    // Componente não opaco: a área repintada também repinta o pai, então ela
+    // fica restrita às linhas que mudaram
+    if (!dirty.isEmpty())
+        repaint(0, dirty.getStart(), getWidth(), dirty.getLength());
+}
@@ -16,13 +16,22 @@ public:
 
     // Método principal para o desenho do medidor
     void paint(juce::Graphics& g) override;
+    void resized() override;
 
-    // Método para receber o novo valor de pico
-    void update(float newPeakValue);
+    // Recebe os níveis já com balística (normalizados: 0.0 a 1.0). Só repinta a
+    // faixa de pixels que mudou; sem mudança visível não repinta nada.
+    void update(float newPeakValue, float newRmsValue = 0.0f, float newHoldValue = 0.0f);
 
 private:
-    // O valor de pico atual (normalizado: 0.0 a 1.0)
-    float peak = 0.0f;
+    // Nível normalizado -> linha (y) do topo da barra; getHeight() = vazio
+    int levelToY(float level) const noexcept;
+    void updateGradientStrip();
+
+    // Topo atual de cada elemento, em pixels
+    int peakY = 0, rmsY = 0, holdY = 0;
+
+    // Gradiente vertical pré-renderizado numa coluna de 1 px (esticada no paint)
+    juce::Image gradientStrip;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BarMeterComponent)
 };
\ No newline at end of file
@@ -0,0 +1,210 @@
+/*
+  ==============================================================================
+
+    BiquadDesign.h
+    Created: 19 Jan 2026 10:02:47pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <cmath>
+
+// Projeto de biquads em forma fechada (RBJ / Butterworth) sem alocação.
+// As fórmulas são as mesmas das fábricas juce::dsp::IIR::Coefficients::make*,
+// então o resultado é numericamente idêntico, mas escrito direto no storage
+// que o filtro já possui (preparado no prepareToPlay).
+namespace BiquadDesign
+{
+    // Coeficientes normalizados por a0, na ordem do juce::dsp::IIR::Coefficients
+    struct Biquad
+    {
+        double b0 = 1.0, b1 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0;
+
+        static constexpr Biquad fromUnnormalised(double b0, double b1, double b2,
+                                                 double a0, double a1, double a2) noexcept
+        {
+            const double invA0 = 1.0 / a0;
+            return { b0 * invA0, b1 * invA0, b2 * invA0, a1 * invA0, a2 * invA0 };
+        }
+
+        constexpr bool operator== (const Biquad& other) const noexcept
+        {
+            return b0 == other.b0 && b1 == other.b1 && b2 == other.b2
+                && a1 == other.a1 && a2 == other.a2;
+        }
+
+        constexpr bool operator!= (const Biquad& other) const noexcept { return !(*this == other); }
+
+        // H(z) = 1 (ex.: peak/shelf a 0 dB, onde o numerador é igual ao denominador)
+        constexpr bool isIdentity() const noexcept { return b0 == 1.0 && b1 == a1 && b2 == a2; }
+    };
+
+    constexpr Biquad identity() noexcept { return {}; }
+
+    constexpr double pi = juce::MathConstants<double>::pi;
+
+    // ===== Peak (RBJ) =====
+    inline Biquad peak(double sampleRate, double frequency, double Q, double gainFactor) noexcept
+    {
+        const double A = juce::jmax(0.0, std::sqrt(gainFactor));
+        const double omega = (2.0 * pi * juce::jmax(frequency, 2.0)) / sampleRate;
+        const double alpha = std::sin(omega) / (Q * 2.0);
+        const double c2 = -2.0 * std::cos(omega);
+        const double alphaTimesA = alpha * A;
+        const double alphaOverA = alpha / A;
+
+        return Biquad::fromUnnormalised(1.0 + alphaTimesA, c2, 1.0 - alphaTimesA,
+                                        1.0 + alphaOverA, c2, 1.0 - alphaOverA);
+    }
+
+    // ===== Low Shelf (RBJ) =====
+    inline Biquad lowShelf(double sampleRate, double cutOffFrequency, double Q, double gainFactor) noexcept
+    {
+        const double A = juce::jmax(0.0, std::sqrt(gainFactor));
+        const double aminus1 = A - 1.0;
+        const double aplus1 = A + 1.0;
+        const double omega = (2.0 * pi * juce::jmax(cutOffFrequency, 2.0)) / sampleRate;
+        const double coso = std::cos(omega);
+        const double beta = std::sin(omega) * std::sqrt(A) / Q;
+        const double aminus1TimesCoso = aminus1 * coso;
+
+        return Biquad::fromUnnormalised(A * (aplus1 - aminus1TimesCoso + beta),
+                                        A * 2.0 * (aminus1 - aplus1 * coso),
+                                        A * (aplus1 - aminus1TimesCoso - beta),
+                                        aplus1 + aminus1TimesCoso + beta,
+                                        -2.0 * (aminus1 + aplus1 * coso),
+                                        aplus1 + aminus1TimesCoso - beta);
+    }
+
+    // ===== High Shelf (RBJ) =====
+    inline Biquad highShelf(double sampleRate, double cutOffFrequency, double Q, double gainFactor) noexcept
+    {
+        const double A = juce::jmax(0.0, std::sqrt(gainFactor));
+        const double aminus1 = A - 1.0;
+        const double aplus1 = A + 1.0;
+        const double omega = (2.0 * pi * juce::jmax(cutOffFrequency, 2.0)) / sampleRate;
+        const double coso = std::cos(omega);
+        const double beta = std::sin(omega) * std::sqrt(A) / Q;
+        const double aminus1TimesCoso = aminus1 * coso;
+
+        return Biquad::fromUnnormalised(A * (aplus1 + aminus1TimesCoso + beta),
+                                        A * -2.0 * (aminus1 + aplus1 * coso),
+                                        A * (aplus1 + aminus1TimesCoso - beta),
+                                        aplus1 - aminus1TimesCoso + beta,
+                                        2.0 * (aminus1 - aplus1 * coso),
+                                        aplus1 - aminus1TimesCoso - beta);
+    }
+
+    // ===== Band-Pass (ganho de pico unitário) =====
+    inline Biquad bandPass(double sampleRate, double frequency, double Q) noexcept
+    {
+        const double n = 1.0 / std::tan(pi * frequency / sampleRate);
+        const double nSquared = n * n;
+        const double invQ = 1.0 / Q;
+        const double c1 = 1.0 / (1.0 + invQ * n + nSquared);
+
+        return { c1 * n * invQ, 0.0, -c1 * n * invQ,
+                 c1 * 2.0 * (1.0 - nSquared),
+                 c1 * (1.0 - invQ * n + nSquared) };
+    }
+
+    // ===== High-Pass / Low-Pass de 2a ordem =====
+    inline Biquad highPass(double sampleRate, double frequency, double Q) noexcept
+    {
+        const double n = std::tan(pi * frequency / sampleRate);
+        const double nSquared = n * n;
+        const double invQ = 1.0 / Q;
+        const double c1 = 1.0 / (1.0 + invQ * n + nSquared);
+
+        return { c1, c1 * -2.0, c1,
+                 c1 * 2.0 * (nSquared - 1.0),
+                 c1 * (1.0 - invQ * n + nSquared) };
+    }
+
+    inline Biquad lowPass(double sampleRate, double frequency, double Q) noexcept
+    {
+        const double n = 1.0 / std::tan(pi * frequency / sampleRate);
+        const double nSquared = n * n;
+        const double invQ = 1.0 / Q;
+        const double c1 = 1.0 / (1.0 + invQ * n + nSquared);
+
+        return { c1, c1 * 2.0, c1,
+                 c1 * 2.0 * (1.0 - nSquared),
+                 c1 * (1.0 - invQ * n + nSquared) };
+    }
+
+    // ===== Butterworth de ordem par, seção a seção =====
+    // Mesmo Q por seção de FilterDesign::designIIR*HighOrderButterworthMethod
+    inline double butterworthQ(int order, int section) noexcept
+    {
+        return 1.0 / (2.0 * std::cos((2.0 * section + 1.0) * pi / (order * 2.0)));
+    }
+
+    inline Biquad butterworthHighPass(double sampleRate, double frequency, int order, int section) noexcept
+    {
+        return highPass(sampleRate, frequency, butterworthQ(order, section));
+    }
+
+    inline Biquad butterworthLowPass(double sampleRate, double frequency, int order, int section) noexcept
+    {
+        return lowPass(sampleRate, frequency, butterworthQ(order, section));
+    }
+
+    // ===== K-weighting (ITU-R BS.1770) =====
+    // Pré-filtro: high shelf de ~+4 dB em ~1.68 kHz, recalculado para a taxa atual
+    inline Biquad kWeightingShelf(double sampleRate) noexcept
+    {
+        const double f0 = 1681.974450955533;
+        const double gainDb = 3.999843853973347;
+        const double Q = 0.7071752369554196;
+
+        const double K = std::tan(pi * f0 / sampleRate);
+        const double Vh = std::pow(10.0, gainDb / 20.0);
+        const double Vb = std::pow(Vh, 0.4996667741545416);
+
+        return Biquad::fromUnnormalised(Vh + Vb * K / Q + K * K,
+                                        2.0 * (K * K - Vh),
+                                        Vh - Vb * K / Q + K * K,
+                                        1.0 + K / Q + K * K,
+                                        2.0 * (K * K - 1.0),
+                                        1.0 - K / Q + K * K);
+    }
+
+    // Filtro RLB: high-pass de 2a ordem em ~38 Hz (numerador não normalizado,
+    // como nos coeficientes de referência da norma)
+    inline Biquad kWeightingHighPass(double sampleRate) noexcept
+    {
+        const double f0 = 38.13547087602444;
+        const double Q = 0.5003270373238773;
+
+        const double K = std::tan(pi * f0 / sampleRate);
+        const double a0 = 1.0 + K / Q + K * K;
+
+        return { 1.0, -2.0, 1.0,
+                 2.0 * (K * K - 1.0) / a0,
+                 (1.0 - K / Q + K * K) / a0 };
+    }
+
+    //==============================================================================
+    // Storage biquad (5 coeficientes) criado fora do audio thread
+    inline juce::dsp::IIR::Coefficients<double>::Ptr makeStorage()
+    {
+        return new juce::dsp::IIR::Coefficients<double>(1.0, 0.0, 0.0, 1.0, 0.0, 0.0);
+    }
+
+    // Escreve os coeficientes no storage existente, sem tocar no heap
+    inline void assign(juce::dsp::IIR::Coefficients<double>& dest, const Biquad& c) noexcept
+    {
+        jassert(dest.coefficients.size() == 5); // storage preparado no prepareToPlay?
+
+        auto* raw = dest.coefficients.getRawDataPointer();
+        raw[0] = c.b0;
+        raw[1] = c.b1;
+        raw[2] = c.b2;
+        raw[3] = c.a1;
+        raw[4] = c.a2;
+    }
+}
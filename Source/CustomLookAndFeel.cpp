@@ -39,19 +39,81 @@ void CustomLookAndFeel::drawRotarySlider(juce::Graphics& g,
     float rotaryStartAngle, float rotaryEndAngle,
     juce::Slider&)
 {
-    // Conversão para float
-    auto bounds = juce::Rectangle<float>(static_cast<float>(x),
-        static_cast<float>(y),
-        static_cast<float>(width),
-        static_cast<float>(height));
-    auto centre = bounds.getCentre();
+    if (width <= 0 || height <= 0)
+        return;
+
+    // Sprites na escala física do contexto: a cópia é 1:1, sem reamostrar
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    auto& sprite = getKnobSprite(width, height, scale);
+
+    const auto bounds = juce::Rectangle<int>(x, y, width, height).toFloat();
+    g.drawImage(sprite.body, bounds);
+
+    // Ângulo absoluto quantizado (independe do range de cada slider)
+    const float angle = rotaryStartAngle + sliderPosProportional * (rotaryEndAngle - rotaryStartAngle);
+    const int step = juce::roundToInt(angle / juce::MathConstants<float>::twoPi * (float)numIndicatorAngles);
+    const int index = ((step % numIndicatorAngles) + numIndicatorAngles) % numIndicatorAngles;
+
+    auto& indicator = sprite.indicators[(size_t)index];
+    auto& area = sprite.indicatorAreas[(size_t)index];
+
+    if (!indicator.isValid())
+    {
+        // =========================================================
+        // 6. INDICADOR CHANFRADO (Mantém original com melhoria)
+        // =========================================================
+        const auto localBounds = bounds.withZeroOrigin();
+        const float quantizedAngle = (float)index * juce::MathConstants<float>::twoPi / (float)numIndicatorAngles;
+
+        juce::Path stroked;
+        getIndicatorStroke(localBounds).createStrokedPath(stroked, createIndicatorPath(localBounds, quantizedAngle),
+                                                          juce::AffineTransform::scale(scale));
+
+        area = stroked.getBounds().getSmallestIntegerContainer().expanded(1);
+        indicator = juce::Image(juce::Image::ARGB, juce::jmax(1, area.getWidth()), juce::jmax(1, area.getHeight()), true);
+
+        // Cor do chanfro: lado sombra (escuro)
+        juce::Graphics indicatorGraphics(indicator);
+        indicatorGraphics.setColour(juce::Colours::black.withAlpha(0.8f));
+        indicatorGraphics.fillPath(stroked, juce::AffineTransform::translation((float)-area.getX(), (float)-area.getY()));
+    }
+
+    g.drawImage(indicator, area.toFloat().transformedBy(juce::AffineTransform::scale(1.0f / scale))
+                               .translated(bounds.getX(), bounds.getY()));
+}
+
+CustomLookAndFeel::KnobSprite& CustomLookAndFeel::getKnobSprite(int width, int height, float scale)
+{
+    const auto key = std::make_tuple(width, height, juce::roundToInt(scale * 100.0f));
+
+    if (auto found = knobSprites.find(key); found != knobSprites.end())
+        return *found->second;
+
+    // Troca de escala/tamanho é rara: ao passar do limite começa do zero
+    if (knobSprites.size() >= maxKnobSprites)
+        knobSprites.clear();
 
+    auto sprite = std::make_unique<KnobSprite>();
+    sprite->body = juce::Image(juce::Image::ARGB,
+                               juce::jmax(1, juce::roundToInt((float)width * scale)),
+                               juce::jmax(1, juce::roundToInt((float)height * scale)),
+                               true);
+
+    juce::Graphics bodyGraphics(sprite->body);
+    bodyGraphics.addTransform(juce::AffineTransform::scale(scale));
+    paintKnobBody(bodyGraphics, juce::Rectangle<int>(width, height).toFloat());
+
+    return *knobSprites.emplace(key, std::move(sprite)).first->second;
+}
+
+void CustomLookAndFeel::paintKnobBody(juce::Graphics& g, juce::Rectangle<float> bounds)
+{
+    auto centre = bounds.getCentre();
 
     // =========================================================
-    // 1. CÁLCULO DE RAIO E ÂNGULO
+    // 1. CÁLCULO DE RAIO
     // =========================================================
-    float radius = juce::jmin(static_cast<float>(width), static_cast<float>(height)) * 0.40f;
-    float angle = rotaryStartAngle + sliderPosProportional * (rotaryEndAngle - rotaryStartAngle);
+    float radius = juce::jmin(bounds.getWidth(), bounds.getHeight()) * 0.40f;
 
     // =========================================================
     // 2. SOMBRA REALISTA (Direcional - Embaixo e Direita)
@@ -105,11 +167,13 @@ void CustomLookAndFeel::drawRotarySlider(juce::Graphics& g,
         centre.getY() - radius * 0.8f,
         radius * 1.4f,
         radius * 0.7f);
+}
 
+juce::Path CustomLookAndFeel::createIndicatorPath(juce::Rectangle<float> bounds, float angle)
+{
+    auto centre = bounds.getCentre();
+    float radius = juce::jmin(bounds.getWidth(), bounds.getHeight()) * 0.40f;
 
-    // =========================================================
-    // 6. INDICADOR CHANFRADO (Mantém original com melhoria)
-    // =========================================================
     float indicatorLength = radius * 0.90f;
     float indicatorThickness = radius * 0.11f;
     float innerOffset = radius * 0.42f;
@@ -126,11 +190,13 @@ void CustomLookAndFeel::drawRotarySlider(juce::Graphics& g,
 
     juce::Path notchPath;
     notchPath.addLineSegment({ startPoint, endPoint }, indicatorThickness);
+    return notchPath;
+}
 
-    // Cor do chanfro: lado sombra (escuro)
-    g.setColour(juce::Colours::black.withAlpha(0.8f));
-    g.strokePath(notchPath, juce::PathStrokeType(indicatorThickness, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
-
+juce::PathStrokeType CustomLookAndFeel::getIndicatorStroke(juce::Rectangle<float> bounds)
+{
+    const float radius = juce::jmin(bounds.getWidth(), bounds.getHeight()) * 0.40f;
+    return juce::PathStrokeType(radius * 0.11f, juce::PathStrokeType::curved, juce::PathStrokeType::rounded);
 }
 
 juce::Label* CustomLookAndFeel::createSliderTextBox(juce::Slider& slider)
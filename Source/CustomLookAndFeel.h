@@ -61,5 +61,25 @@ private:
     juce::Colour backgroundArcColour;
     juce::Colour foregroundArcColour;
 
+    // Sprites do knob por tamanho e escala: sombra + corpo renderizados uma vez,
+    // indicador por ângulo quantizado (gerado sob demanda). Arrastar um knob vira
+    // duas cópias de imagem. Só o message thread usa.
+    static constexpr int numIndicatorAngles = 512;
+    static constexpr size_t maxKnobSprites = 16;
+
+    struct KnobSprite
+    {
+        juce::Image body;
+        std::array<juce::Image, numIndicatorAngles> indicators;
+        std::array<juce::Rectangle<int>, numIndicatorAngles> indicatorAreas; // pixels físicos, relativos ao knob
+    };
+
+    std::map<std::tuple<int, int, int>, std::unique_ptr<KnobSprite>> knobSprites;
+
+    KnobSprite& getKnobSprite(int width, int height, float scale);
+    static void paintKnobBody(juce::Graphics& g, juce::Rectangle<float> bounds);
+    static juce::Path createIndicatorPath(juce::Rectangle<float> bounds, float angle);
+    static juce::PathStrokeType getIndicatorStroke(juce::Rectangle<float> bounds);
+
 
 };
\ No newline at end of file
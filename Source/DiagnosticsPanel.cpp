@@ -0,0 +1,88 @@
+/*
+  ==============================================================================
+
+    DiagnosticsPanel.cpp
+    Created: 25 Feb 2026 9:31:40pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "DiagnosticsPanel.h"
+
+#if TELEQ_ENABLE_PROFILING
+
+DiagnosticsPanel::DiagnosticsPanel(StageProfiler& profilerToShow)
+    : profiler(profilerToShow)
+{
+    setOpaque(false);
+
+    resetButton.onClick = [this] { profiler.requestReset(); };
+    addAndMakeVisible(resetButton);
+
+    timerCallback();
+    startTimerHz(4);
+}
+
+DiagnosticsPanel::~DiagnosticsPanel()
+{
+    stopTimer();
+}
+
+void DiagnosticsPanel::timerCallback()
+{
+    for (int stage = 0; stage < StageProfiler::NumStages; ++stage)
+        stats[(size_t)stage] = profiler.getStats(stage);
+
+    repaint();
+}
+
+void DiagnosticsPanel::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat();
+
+    g.setColour(juce::Colour(0xE0101010));
+    g.fillRoundedRectangle(bounds, 6.0f);
+    g.setColour(juce::Colours::cyan.withAlpha(0.6f));
+    g.drawRoundedRectangle(bounds.reduced(0.5f), 6.0f, 1.0f);
+
+    auto area = getLocalBounds().reduced(8);
+    area.removeFromTop(resetButton.getHeight() + 4);
+
+    const int rowHeight = juce::jmin(16, area.getHeight() / (StageProfiler::NumStages + 1));
+    const int nameWidth = area.getWidth() / 5;
+    const int valueWidth = (area.getWidth() - nameWidth) / 4;
+
+    g.setFont(12.0f);
+
+    auto drawRow = [&](juce::Rectangle<int> row, const juce::String& name, const juce::StringArray& values)
+    {
+        g.drawText(name, row.removeFromLeft(nameWidth), juce::Justification::centredLeft);
+
+        for (const auto& value : values)
+            g.drawText(value, row.removeFromLeft(valueWidth), juce::Justification::centredRight);
+    };
+
+    g.setColour(juce::Colours::white.withAlpha(0.6f));
+    drawRow(area.removeFromTop(rowHeight), "Stage", { "mean us", "p99 us", "max us", "deadline" });
+
+    for (int stage = 0; stage < StageProfiler::NumStages; ++stage)
+    {
+        const auto& s = stats[(size_t)stage];
+
+        // Total acima de ~50% do bloco já é arriscado em sessão pesada
+        g.setColour(stage == StageProfiler::Total && s.deadlineRatio > 0.5 ? juce::Colour(0xFFe74c3c)
+                                                                           : juce::Colours::white);
+
+        drawRow(area.removeFromTop(rowHeight), StageProfiler::getStageName(stage),
+                { juce::String(s.meanMicroseconds, 1), juce::String(s.p99Microseconds, 1),
+                  juce::String(s.maxMicroseconds, 1), juce::String(s.deadlineRatio * 100.0, 1) + "%" });
+    }
+}
+
+void DiagnosticsPanel::resized()
+{
+    resetButton.setBounds(getLocalBounds().reduced(8).removeFromTop(18).removeFromRight(60));
+}
+
+#endif
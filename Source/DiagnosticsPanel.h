@@ -0,0 +1,40 @@
+/*
+  ==============================================================================
+
+    DiagnosticsPanel.h
+    Created: 25 Feb 2026 9:31:40pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "StageProfiler.h"
+
+#if TELEQ_ENABLE_PROFILING
+
+// Painel escondido (Alt + clique no logo) com o custo de cada estágio do
+// processBlock: média, p99, máximo e fração do tempo do bloco
+class DiagnosticsPanel : public juce::Component,
+                         private juce::Timer
+{
+public:
+    explicit DiagnosticsPanel(StageProfiler& profilerToShow);
+    ~DiagnosticsPanel() override;
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+
+private:
+    void timerCallback() override;
+
+    StageProfiler& profiler;
+    std::array<StageProfiler::Stats, StageProfiler::NumStages> stats{};
+
+    juce::TextButton resetButton{ "Reset" };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DiagnosticsPanel)
+};
+
+#endif
@@ -0,0 +1,47 @@
+/*
+  ==============================================================================
+
+    EditorAssets.cpp
+    Created: 6 Mar 2026 9:14:08pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "EditorAssets.h"
+
+EditorAssets::EditorAssets()
+    : frankRuehlTypeface(juce::Typeface::createSystemTypefaceFor(BinaryData::FrankRuehlCLM_ttf, BinaryData::FrankRuehlCLM_ttfSize)),
+      latoBlackTypeface(juce::Typeface::createSystemTypefaceFor(BinaryData::LatoBlack_ttf, BinaryData::LatoBlack_ttfSize)),
+      phonesTypeface(juce::Typeface::createSystemTypefaceFor(BinaryData::PHONES_TTF, BinaryData::PHONES_TTFSize)),
+      logo(juce::Drawable::createFromImageData(BinaryData::Logo_svg, BinaryData::Logo_svgSize)),
+      background(juce::ImageFileFormat::loadFrom(BinaryData::Background_png, BinaryData::Background_pngSize))
+{
+    lookAndFeel.phonesTypeface = phonesTypeface;
+}
+
+juce::Font EditorAssets::getFont(FontId id, float height) const
+{
+    const auto& typeface = id == FontId::FrankRuehl ? frankRuehlTypeface
+                         : id == FontId::LatoBlack  ? latoBlackTypeface
+                                                    : phonesTypeface;
+
+    return juce::Font(juce::FontOptions(typeface).withHeight(height));
+}
+
+juce::Image EditorAssets::getBackground(int physicalWidth, int physicalHeight)
+{
+    if (!background.isValid() || physicalWidth <= 0 || physicalHeight <= 0)
+        return background;
+
+    for (const auto& image : scaledBackgrounds)
+        if (image.getWidth() == physicalWidth && image.getHeight() == physicalHeight)
+            return image;
+
+    // Mais antigo sai primeiro
+    if (scaledBackgrounds.size() >= maxScaledBackgrounds)
+        scaledBackgrounds.erase(scaledBackgrounds.begin());
+
+    scaledBackgrounds.push_back(background.rescaled(physicalWidth, physicalHeight, juce::Graphics::highResamplingQuality));
+    return scaledBackgrounds.back();
+}
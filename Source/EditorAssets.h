@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+
+    EditorAssets.h
+    Created: 6 Mar 2026 9:14:08pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "CustomLookAndFeel.h"
+
+// Recursos do editor compartilhados por todas as instâncias do processo, via
+// juce::SharedResourcePointer<EditorAssets>: o SVG do logo, o PNG de fundo e as
+// fontes são decodificados uma vez, quando o primeiro editor abre, e liberados
+// quando o último fecha. Só o message thread usa.
+class EditorAssets
+{
+public:
+    EditorAssets();
+
+    enum class FontId
+    {
+        FrankRuehl,  // título do plugin
+        LatoBlack,   // nome da marca
+        Phones       // símbolo / telefy
+    };
+
+    juce::Font getFont(FontId id, float height) const;
+
+    // Cópia do logo já parseado (o DrawableButton guarda a sua)
+    const juce::Drawable* getLogo() const noexcept { return logo.get(); }
+
+    // Fundo reamostrado para o tamanho físico pedido (cache dos últimos tamanhos)
+    juce::Image getBackground(int physicalWidth, int physicalHeight);
+
+    CustomLookAndFeel& getLookAndFeel() noexcept { return lookAndFeel; }
+
+private:
+    juce::Typeface::Ptr frankRuehlTypeface, latoBlackTypeface, phonesTypeface;
+    std::unique_ptr<juce::Drawable> logo;
+    juce::Image background;
+
+    // Poucos tamanhos em uso ao mesmo tempo (um por escala de monitor)
+    static constexpr size_t maxScaledBackgrounds = 4;
+    std::vector<juce::Image> scaledBackgrounds;
+
+    CustomLookAndFeel lookAndFeel;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EditorAssets)
+};
@@ -0,0 +1,197 @@
+/*
+  ==============================================================================
+
+    FixedBiquadCascade.h
+    Created: 9 Feb 2026 7:55:03pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "BiquadDesign.h"
+
+// Topologia usada para realizar cada biquad da cascata
+enum class FilterTopology
+{
+    Tdf2,   // Transposed Direct Form II (igual ao juce::dsp::IIR::Filter)
+    Svf     // State Variable Filter trapezoidal (Cytomic/Simper) - modula melhor
+};
+
+// Cascata mono de ordem fixa em tempo de compilação. Coeficientes e estado de
+// todos os estágios ficam contíguos, e o laço por amostra é desenrolado via
+// index_sequence, sem checagem de ordem por amostra como no IIR::Filter genérico.
+template <int NumStages>
+class FixedBiquadCascade
+{
+public:
+    FixedBiquadCascade()
+    {
+        for (int i = 0; i < NumStages; ++i)
+            setCoefficients(i, BiquadDesign::identity());
+
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        state.fill(0.0);
+    }
+
+    void setCoefficients(int stageIndex, const BiquadDesign::Biquad& c) noexcept
+    {
+        jassert(juce::isPositiveAndBelow(stageIndex, NumStages));
+
+        auto* tdf = tdfCoefficients.data() + stageIndex * numTdfCoefficients;
+        tdf[0] = c.b0;
+        tdf[1] = c.b1;
+        tdf[2] = c.b2;
+        tdf[3] = c.a1;
+        tdf[4] = c.a2;
+
+        computeSvfCoefficients(c, svfCoefficients.data() + stageIndex * numSvfCoefficients);
+    }
+
+    void setBypassed(int stageIndex, bool shouldBeBypassed) noexcept
+    {
+        jassert(juce::isPositiveAndBelow(stageIndex, NumStages));
+        bypassed[(size_t)stageIndex] = shouldBeBypassed;
+    }
+
+    // Estágio identidade (ganho 0 dB): pulado sem custo. No TDF-II o estágio continua
+    // rodando até o estado decair (a cauda do ganho anterior sai inteira, mesmo num
+    // salto de preset ou bypass que pula a rampa) e só então é pulado com estado zero,
+    // que é para onde H(z) = 1 converge; a volta parte desse zero, sem salto. No SVF
+    // a saída de H(z) = 1 não depende do estado, então a elisão é imediata.
+    void setElided(int stageIndex, bool shouldBeElided) noexcept
+    {
+        jassert(juce::isPositiveAndBelow(stageIndex, NumStages));
+
+        elisionPending[(size_t)stageIndex] = shouldBeElided && !elided[(size_t)stageIndex];
+
+        if (!shouldBeElided)
+            elided[(size_t)stageIndex] = false;
+    }
+
+    // A topologia é escolhida uma vez por bloco
+    void process(double* samples, int numSamples, FilterTopology topology) noexcept
+    {
+        if (topology == FilterTopology::Svf)
+            processBlock<FilterTopology::Svf>(samples, numSamples);
+        else
+            processBlock<FilterTopology::Tdf2>(samples, numSamples);
+    }
+
+private:
+    void resetStage(int stageIndex) noexcept
+    {
+        state[(size_t)(stageIndex * numStateValues)] = 0.0;
+        state[(size_t)(stageIndex * numStateValues + 1)] = 0.0;
+    }
+
+    static constexpr int numTdfCoefficients = 5;  // b0 b1 b2 a1 a2
+    static constexpr int numSvfCoefficients = 6;  // a1 a2 a3 m0 m1 m2 (notação Simper)
+    static constexpr int numStateValues = 2;      // s1 s2 / ic1eq ic2eq
+
+    template <FilterTopology Topology>
+    void processBlock(double* samples, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+            samples[i] = processSample<Topology>(samples[i], std::make_index_sequence<(size_t)NumStages>());
+
+        for (auto& s : state)
+            juce::dsp::util::snapToZero(s);
+
+        completePendingElisions<Topology>();
+    }
+
+    template <FilterTopology Topology>
+    void completePendingElisions() noexcept
+    {
+        for (int stage = 0; stage < NumStages; ++stage)
+        {
+            if (!elisionPending[(size_t)stage])
+                continue;
+
+            const auto* s = state.data() + stage * numStateValues;
+
+            if (Topology == FilterTopology::Svf || (s[0] == 0.0 && s[1] == 0.0))
+            {
+                resetStage(stage);
+                elided[(size_t)stage] = true;
+                elisionPending[(size_t)stage] = false;
+            }
+        }
+    }
+
+    template <FilterTopology Topology, size_t... Stage>
+    double processSample(double x, std::index_sequence<Stage...>) noexcept
+    {
+        ((x = processStage<Topology, (int)Stage>(x)), ...);
+        return x;
+    }
+
+    template <FilterTopology Topology, int Stage>
+    double processStage(double x) noexcept
+    {
+        if (bypassed[(size_t)Stage] || elided[(size_t)Stage])
+            return x;
+
+        auto* s = state.data() + Stage * numStateValues;
+
+        if constexpr (Topology == FilterTopology::Tdf2)
+        {
+            const auto* c = tdfCoefficients.data() + Stage * numTdfCoefficients;
+
+            const double y = c[0] * x + s[0];
+            s[0] = c[1] * x - c[3] * y + s[1];
+            s[1] = c[2] * x - c[4] * y;
+            return y;
+        }
+        else
+        {
+            const auto* c = svfCoefficients.data() + Stage * numSvfCoefficients;
+
+            const double v3 = x - s[1];
+            const double v1 = c[0] * s[0] + c[1] * v3;
+            const double v2 = s[1] + c[1] * s[0] + c[2] * v3;
+            s[0] = 2.0 * v1 - s[0];
+            s[1] = 2.0 * v2 - s[1];
+            return c[3] * x + c[4] * v1 + c[5] * v2;
+        }
+    }
+
+    // Converte um biquad normalizado para o SVF trapezoidal equivalente:
+    // mesmos polos (g, k) e numerador recomposto como m0*x + m1*BP + m2*LP
+    static void computeSvfCoefficients(const BiquadDesign::Biquad& c, double* svf) noexcept
+    {
+        const double onePlusA = 1.0 + c.a1 + c.a2;   // 4g^2 / D
+        const double oneMinusA = 1.0 - c.a1 + c.a2;  // 4 / D
+
+        const double g = std::sqrt(juce::jmax(onePlusA / oneMinusA, 1.0e-24));
+        const double k = 2.0 * (1.0 - c.a2) / (g * oneMinusA);
+        const double d = 4.0 / oneMinusA;
+
+        const double m0 = (c.b0 - c.b1 + c.b2) / oneMinusA;
+        const double lowPassPart = 0.5 * (c.b1 - m0 * c.a1);
+        const double bandPassPart = c.b0 - m0 - lowPassPart;
+
+        const double a1 = 1.0 / (1.0 + g * (g + k));
+        svf[0] = a1;
+        svf[1] = g * a1;
+        svf[2] = g * g * a1;
+        svf[3] = m0;
+        svf[4] = bandPassPart * d / g;
+        svf[5] = lowPassPart * d / (g * g);
+    }
+
+    std::array<double, (size_t)(NumStages * numTdfCoefficients)> tdfCoefficients{};
+    std::array<double, (size_t)(NumStages * numSvfCoefficients)> svfCoefficients{};
+    std::array<double, (size_t)(NumStages * numStateValues)> state{};
+    std::array<bool, (size_t)NumStages> bypassed{};
+    std::array<bool, (size_t)NumStages> elided{};
+    std::array<bool, (size_t)NumStages> elisionPending{};
+
+    JUCE_LEAK_DETECTOR(FixedBiquadCascade)
+};
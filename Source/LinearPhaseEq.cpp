@@ -0,0 +1,226 @@
+/*
+  ==============================================================================
+
+    LinearPhaseEq.cpp
+    Created: 14 Mar 2026 9:12:40pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "LinearPhaseEq.h"
+#include <complex>
+
+namespace
+{
+    // Cabeça da partição não uniforme: a convolução não adiciona latência
+    constexpr int nonUniformHeadSize = 256;
+}
+
+LinearPhaseEq::LinearPhaseEq(ResponseCurveSource& sourceToUse, int numStagesToUse)
+    : juce::Thread("TeLeQ Linear Phase"),
+      source(sourceToUse),
+      numStages(juce::jlimit(1, sourceToUse.getNumStages(), numStagesToUse)),
+      stages((size_t)numStages),
+      stageVersions((size_t)numStages, 0)
+{
+}
+
+LinearPhaseEq::~LinearPhaseEq()
+{
+    stopThread(2000);
+}
+
+void LinearPhaseEq::prepare(int numChannels, int maxBlockSize, double sampleRate,
+                            int lengthLog2, Partitioning partitioning)
+{
+    // O thread de projeto não pode ver os engines sendo reconstruídos
+    stopThread(2000);
+
+    lengthLog2 = juce::jlimit(minLengthLog2, maxLengthLog2, lengthLog2);
+    kernelLength = 1 << lengthLog2;
+    designSampleRate = sampleRate;
+
+    fft = std::make_unique<juce::dsp::FFT>(lengthLog2);
+    spectrum.assign((size_t)kernelLength * 2, 0.0f);
+
+    // Blackman de N + 1 pontos: zero no tap 0 e simétrica em torno de N / 2
+    window.assign((size_t)kernelLength + 1, 0.0f);
+    juce::dsp::WindowingFunction<float>::fillWindowingTables(window.data(), window.size(),
+                                                             juce::dsp::WindowingFunction<float>::blackman, false);
+
+    numChannels = juce::jmax(1, numChannels);
+    const juce::dsp::ProcessSpec spec{ sampleRate, (juce::uint32)maxBlockSize, 2 };
+
+    convolutions.clear();
+
+    for (int first = 0; first < numChannels; first += 2)
+    {
+        convolutions.push_back(partitioning == Partitioning::NonUniform
+            ? std::make_unique<juce::dsp::Convolution>(juce::dsp::Convolution::NonUniform{ nonUniformHeadSize }, loadQueue)
+            : std::make_unique<juce::dsp::Convolution>(juce::dsp::Convolution::Latency{ 0 }, loadQueue));
+    }
+
+    // O load é assíncrono, mas Convolution::prepare esvazia a fila de carga e
+    // monta o engine com o IR pendente: projetando antes do prepare, o primeiro
+    // kernel já é o ativo, sem passar pelo IR identidade nem pelo crossfade
+    readStages();
+    designKernel();
+
+    for (auto& convolution : convolutions)
+        convolution->prepare(spec);
+
+    floatBuffer.setSize(numChannels, juce::jmax(1, maxBlockSize));
+    floatBuffer.clear();
+
+    startThread(juce::Thread::Priority::low);
+}
+
+void LinearPhaseEq::release()
+{
+    stopThread(2000);
+    convolutions.clear();
+    floatBuffer.setSize(0, 0);
+    fft.reset();
+    kernelLength = 0;
+}
+
+int LinearPhaseEq::getLatencyInSamples() const noexcept
+{
+    if (convolutions.empty())
+        return 0;
+
+    return kernelLength / 2 + convolutions.front()->getLatency();
+}
+
+void LinearPhaseEq::reset() noexcept
+{
+    for (auto& convolution : convolutions)
+        convolution->reset();
+}
+
+void LinearPhaseEq::process(juce::AudioBuffer<double>& buffer) noexcept
+{
+    const int numChannels = juce::jmin(buffer.getNumChannels(), floatBuffer.getNumChannels());
+    const int numSamples = buffer.getNumSamples();
+    jassert(numSamples <= floatBuffer.getNumSamples());
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const double* input = buffer.getReadPointer(ch);
+        float* output = floatBuffer.getWritePointer(ch);
+
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = (float)input[i];
+    }
+
+    juce::dsp::AudioBlock<float> block(floatBuffer.getArrayOfWritePointers(), (size_t)numChannels, (size_t)numSamples);
+
+    for (size_t engine = 0; engine < convolutions.size(); ++engine)
+    {
+        const int first = (int)engine * 2;
+
+        if (first >= numChannels)
+            break;
+
+        auto pair = block.getSubsetChannelBlock((size_t)first, (size_t)juce::jmin(2, numChannels - first));
+        convolutions[engine]->process(juce::dsp::ProcessContextReplacing<float>(pair));
+
+        // Garantia: sem o kernel de fase linear ativo, o engine passaria o sinal
+        // sem atraso enquanto o host já compensa N/2 amostras; melhor silêncio
+        if (convolutions[engine]->getCurrentIRSize() != kernelLength)
+            pair.clear();
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const float* input = floatBuffer.getReadPointer(ch);
+        double* output = buffer.getWritePointer(ch);
+
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = (double)input[i];
+    }
+}
+
+void LinearPhaseEq::run()
+{
+    // Mesmo polling da curva de resposta: o audio thread não acorda threads.
+    // Durante automação sai no máximo um kernel a cada 20 ms; o crossfade da
+    // Convolution cobre os passos entre eles.
+    while (!threadShouldExit())
+    {
+        if (readStages())
+            designKernel();
+
+        wait(20);
+    }
+}
+
+bool LinearPhaseEq::readStages()
+{
+    bool changed = false;
+
+    for (int stage = 0; stage < numStages; ++stage)
+    {
+        const auto version = source.read(stage, stages[(size_t)stage]);
+
+        if (version != stageVersions[(size_t)stage])
+        {
+            stageVersions[(size_t)stage] = version;
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+void LinearPhaseEq::designKernel()
+{
+    const int n = kernelLength;
+
+    // Magnitude alvo nos bins 0 .. N/2, fase zero (parte imaginária nula)
+    std::fill(spectrum.begin(), spectrum.end(), 0.0f);
+
+    for (int bin = 0; bin <= n / 2; ++bin)
+    {
+        const double omega = juce::MathConstants<double>::twoPi * bin / n;
+        double magnitude = 1.0;
+
+        for (const auto& stage : stages)
+            if (stage.enabled)
+                magnitude *= getStageMagnitude(stage, omega);
+
+        spectrum[(size_t)bin * 2] = (float)magnitude;
+    }
+
+    // Resposta real e par (já escalada por 1/N), centrada em 0 de forma circular
+    fft->performRealOnlyInverseTransform(spectrum.data());
+
+    // Rotaciona o centro para N/2 e janela: h[N/2 + k] == h[N/2 - k]
+    juce::AudioBuffer<float> kernel(1, n);
+    float* taps = kernel.getWritePointer(0);
+
+    for (int i = 0; i < n; ++i)
+        taps[i] = spectrum[(size_t)((i + n / 2) & (n - 1))] * window[(size_t)i];
+
+    // Sem trim nem normalização: o ganho e o centro do kernel definem a latência
+    for (size_t engine = 0; engine < convolutions.size(); ++engine)
+    {
+        auto impulse = engine + 1 < convolutions.size() ? juce::AudioBuffer<float>(kernel) : std::move(kernel);
+
+        convolutions[engine]->loadImpulseResponse(std::move(impulse), designSampleRate,
+                                                  juce::dsp::Convolution::Stereo::no,
+                                                  juce::dsp::Convolution::Trim::no,
+                                                  juce::dsp::Convolution::Normalise::no);
+    }
+}
+
+double LinearPhaseEq::getStageMagnitude(const ResponseCurveSource::StageSnapshot& snapshot, double omega) noexcept
+{
+    const auto& c = snapshot.coefficients;
+    const auto z1 = std::polar(1.0, -omega);
+    const auto z2 = z1 * z1;
+
+    const auto response = (c.b0 + c.b1 * z1 + c.b2 * z2) / (1.0 + c.a1 * z1 + c.a2 * z2);
+    return snapshot.gain * std::abs((1.0 - snapshot.mix) + snapshot.mix * response);
+}
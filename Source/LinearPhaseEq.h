@@ -0,0 +1,84 @@
+/*
+  ==============================================================================
+
+    LinearPhaseEq.h
+    Created: 14 Mar 2026 9:12:40pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "ResponseCurve.h"
+
+// Modo de fase linear do EQ principal (bandas + HPF/LPF). A magnitude alvo é a
+// da cascata em uso (os estágios que o audio thread deriva do ChainSettings e
+// publica no ResponseCurveSource); um thread de background amostra essa
+// magnitude nos bins de uma FFT, faz a IFFT com fase zero e janela o resultado
+// num FIR simétrico. O FIR roda por convolução FFT particionada
+// (juce::dsp::Convolution), que carrega o kernel fora do audio thread e faz o
+// crossfade entre o kernel antigo e o novo.
+class LinearPhaseEq : private juce::Thread
+{
+public:
+    // 4096 .. 32768 taps: FIR mais longo = mais latência e mais resolução em graves
+    static constexpr int minLengthLog2 = 12, maxLengthLog2 = 15;
+    static constexpr int defaultLengthLog2 = 13;
+
+    enum class Partitioning
+    {
+        Uniform,    // partições do tamanho do bloco do host (melhor com blocos grandes)
+        NonUniform  // cabeça curta + cauda em partições maiores (melhor com blocos pequenos)
+    };
+
+    // Os numStages primeiros estágios do source formam o EQ
+    LinearPhaseEq(ResponseCurveSource& sourceToUse, int numStagesToUse);
+    ~LinearPhaseEq() override;
+
+    // ===== Message thread (com o processamento suspenso) =====
+    void prepare(int numChannels, int maxBlockSize, double sampleRate,
+                 int lengthLog2, Partitioning partitioning);
+    void release();
+
+    bool isPrepared() const noexcept { return !convolutions.empty(); }
+    int getKernelLength() const noexcept { return kernelLength; }
+
+    // Metade do FIR (centro do kernel simétrico) + a latência da convolução
+    int getLatencyInSamples() const noexcept;
+
+    // ===== Audio thread =====
+    void reset() noexcept;
+    void process(juce::AudioBuffer<double>& buffer) noexcept;
+
+private:
+    void run() override;
+
+    // true se algum estágio (ou o sample rate) mudou desde o último kernel
+    bool readStages();
+    void designKernel();
+
+    // |H(e^jw)| de um estágio: gain * |(1 - mix) + mix * B(e^jw)|
+    static double getStageMagnitude(const ResponseCurveSource::StageSnapshot& snapshot, double omega) noexcept;
+
+    ResponseCurveSource& source;
+    const int numStages;
+
+    // Convolution processa até 2 canais: um engine por par de canais, todos
+    // com a mesma fila de carga de IR
+    juce::dsp::ConvolutionMessageQueue loadQueue;
+    std::vector<std::unique_ptr<juce::dsp::Convolution>> convolutions;
+
+    // Convolution é float: o bloco double passa por este buffer
+    juce::AudioBuffer<float> floatBuffer;
+
+    // Estado do thread de projeto
+    int kernelLength = 0;
+    double designSampleRate = 0.0;
+    std::unique_ptr<juce::dsp::FFT> fft;
+    std::vector<float> spectrum, window;
+    std::vector<ResponseCurveSource::StageSnapshot> stages;
+    std::vector<juce::uint32> stageVersions;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LinearPhaseEq)
+};
@@ -0,0 +1,173 @@
+/*
+  ==============================================================================
+
+    LinkedBiquadCascade.h
+    Created: 2 Feb 2026 8:41:12pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "BiquadDesign.h"
+
+// Cascata de biquads TDF-II que processa um grupo de canais junto, um canal por
+// lane de um registrador SIMD (SSE2/NEON: 2 canais, AVX: 4, via
+// juce::dsp::SIMDRegister<double>). Só serve quando os canais do grupo usam os
+// mesmos coeficientes, que é sempre o caso no EQ do TeLeQ.
+template <int NumStages>
+class LinkedBiquadCascade
+{
+public:
+    using Vec = juce::dsp::SIMDRegister<double>;
+
+    static constexpr int numLanes = (int)Vec::SIMDNumElements;
+
+    // Precisa de pelo menos 2 lanes para valer a pena agrupar
+    static constexpr bool isAvailable = numLanes >= 2;
+
+    LinkedBiquadCascade()
+    {
+        for (int i = 0; i < NumStages; ++i)
+            setCoefficients(i, BiquadDesign::identity());
+
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        for (auto& stage : stages)
+        {
+            stage.s1 = Vec::expand(0.0);
+            stage.s2 = Vec::expand(0.0);
+        }
+    }
+
+    void setCoefficients(int stageIndex, const BiquadDesign::Biquad& c) noexcept
+    {
+        jassert(juce::isPositiveAndBelow(stageIndex, NumStages));
+        auto& stage = stages[(size_t)stageIndex];
+
+        // Mesmo coeficiente em todas as lanes
+        stage.b0 = Vec::expand(c.b0);
+        stage.b1 = Vec::expand(c.b1);
+        stage.b2 = Vec::expand(c.b2);
+        stage.a1 = Vec::expand(c.a1);
+        stage.a2 = Vec::expand(c.a2);
+    }
+
+    void setBypassed(int stageIndex, bool shouldBeBypassed) noexcept
+    {
+        jassert(juce::isPositiveAndBelow(stageIndex, NumStages));
+        bypassed[(size_t)stageIndex] = shouldBeBypassed;
+    }
+
+    // Estágio identidade (ganho 0 dB): continua rodando até o estado decair (como
+    // na FixedBiquadCascade) e só então é pulado sem custo, com estado zero
+    void setElided(int stageIndex, bool shouldBeElided) noexcept
+    {
+        jassert(juce::isPositiveAndBelow(stageIndex, NumStages));
+
+        elisionPending[(size_t)stageIndex] = shouldBeElided && !elided[(size_t)stageIndex];
+
+        if (!shouldBeElided)
+            elided[(size_t)stageIndex] = false;
+    }
+
+    bool isBypassed(int stageIndex) const noexcept { return bypassed[(size_t)stageIndex]; }
+
+    // Processa até numLanes canais; as lanes que sobram ficam em zero
+    void process(double* const* channels, int numChannels, int numSamples) noexcept
+    {
+        jassert(juce::isPositiveAndNotGreaterThan(numChannels, numLanes));
+        alignas(sizeof(Vec)) double frame[Vec::SIMDNumElements] = {};
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+                frame[ch] = channels[ch][i];
+
+            auto x = Vec::fromRawArray(frame);
+
+            // NumStages é constante: o compilador desenrola a cascata inteira
+            for (int s = 0; s < NumStages; ++s)
+            {
+                if (bypassed[(size_t)s] || elided[(size_t)s])
+                    continue;
+
+                auto& stage = stages[(size_t)s];
+                const auto y = (stage.b0 * x) + stage.s1;
+                stage.s1 = (stage.b1 * x) - (stage.a1 * y) + stage.s2;
+                stage.s2 = (stage.b2 * x) - (stage.a2 * y);
+                x = y;
+            }
+
+            x.copyToRawArray(frame);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                channels[ch][i] = frame[ch];
+        }
+
+        // Evita denormais no estado quando o sinal some
+        for (auto& stage : stages)
+        {
+            stage.s1 = snapToZero(stage.s1);
+            stage.s2 = snapToZero(stage.s2);
+        }
+
+        // Elisões pendentes entram quando o estado do estágio decaiu a zero
+        for (int s = 0; s < NumStages; ++s)
+        {
+            if (elisionPending[(size_t)s] && isZero(stages[(size_t)s].s1) && isZero(stages[(size_t)s].s2))
+            {
+                resetStage(s);
+                elided[(size_t)s] = true;
+                elisionPending[(size_t)s] = false;
+            }
+        }
+    }
+
+private:
+    void resetStage(int stageIndex) noexcept
+    {
+        stages[(size_t)stageIndex].s1 = Vec::expand(0.0);
+        stages[(size_t)stageIndex].s2 = Vec::expand(0.0);
+    }
+
+    struct Stage
+    {
+        Vec b0, b1, b2, a1, a2;
+        Vec s1, s2;
+    };
+
+    static Vec snapToZero(Vec v) noexcept
+    {
+        alignas(sizeof(Vec)) double lanes[Vec::SIMDNumElements];
+        v.copyToRawArray(lanes);
+
+        for (auto& lane : lanes)
+            juce::dsp::util::snapToZero(lane);
+
+        return Vec::fromRawArray(lanes);
+    }
+
+    static bool isZero(Vec v) noexcept
+    {
+        alignas(sizeof(Vec)) double lanes[Vec::SIMDNumElements];
+        v.copyToRawArray(lanes);
+
+        for (auto lane : lanes)
+            if (lane != 0.0)
+                return false;
+
+        return true;
+    }
+
+    std::array<Stage, (size_t)NumStages> stages;
+    std::array<bool, (size_t)NumStages> bypassed{};
+    std::array<bool, (size_t)NumStages> elided{};
+    std::array<bool, (size_t)NumStages> elisionPending{};
+
+    JUCE_LEAK_DETECTOR(LinkedBiquadCascade)
+};
@@ -0,0 +1,82 @@
+/*
+  ==============================================================================
+
+    MeterBallistics.h
+    Created: 4 Mar 2026 8:22:51pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// Balística de um canal de meter, por tempo (timestamps dos frames), então não
+// depende do período do timer da UI: pico com queda em dB/s e peak-hold, RMS
+// com média exponencial de potência.
+class MeterBallistics
+{
+public:
+    static constexpr float floorDb = -100.0f;
+
+    void setRelease(float decibelsPerSecond) noexcept { releaseDbPerSecond = decibelsPerSecond; }
+    void setHoldTime(double seconds) noexcept { holdSeconds = seconds; }
+    void setRmsTime(double seconds) noexcept { rmsSeconds = seconds; }
+
+    // Frames em ordem de timestamp (segundos)
+    void addFrame(float peakGain, float rmsGain, double timestamp) noexcept
+    {
+        const bool isFirstFrame = lastTime <= 0.0;
+        const double dt = advanceTo(timestamp);
+        const float frameDb = juce::Decibels::gainToDecibels(peakGain, floorDb);
+
+        if (frameDb >= peakDb)
+            peakDb = frameDb;
+
+        if (frameDb >= holdDb)
+        {
+            holdDb = frameDb;
+            holdStart = timestamp;
+        }
+
+        // Potência média exponencial (o advanceTo já decaiu a parte antiga);
+        // o primeiro frame entra direto
+        const double weight = isFirstFrame ? 1.0 : 1.0 - std::exp(-dt / rmsSeconds);
+        meanSquare += double(rmsGain) * rmsGain * weight;
+    }
+
+    // Sem frames novos (transporte parado) o meter continua caindo pelo relógio
+    double advanceTo(double now) noexcept
+    {
+        const double dt = lastTime > 0.0 ? juce::jmax(0.0, now - lastTime) : 0.0;
+        lastTime = juce::jmax(lastTime, now);
+
+        const float fall = releaseDbPerSecond * (float)dt;
+        meanSquare *= std::exp(-dt / rmsSeconds);
+        peakDb = juce::jmax(floorDb, peakDb - fall);
+
+        if (now - holdStart > holdSeconds)
+            holdDb = juce::jmax(floorDb, holdDb - fall);
+
+        return dt;
+    }
+
+    float getPeak() const noexcept { return juce::Decibels::decibelsToGain(peakDb, floorDb); }
+    float getPeakHold() const noexcept { return juce::Decibels::decibelsToGain(holdDb, floorDb); }
+    float getRms() const noexcept { return (float)std::sqrt(meanSquare); }
+
+    // Tudo abaixo do piso: o meter não muda mais até chegar sinal
+    bool isAtRest() const noexcept
+    {
+        return peakDb <= floorDb && holdDb <= floorDb && meanSquare < 1.0e-10;
+    }
+
+private:
+    float releaseDbPerSecond = 24.0f;
+    double holdSeconds = 1.5;
+    double rmsSeconds = 0.3;
+
+    float peakDb = floorDb, holdDb = floorDb;
+    double meanSquare = 0.0;
+    double lastTime = 0.0, holdStart = 0.0;
+};
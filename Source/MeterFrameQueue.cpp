@@ -0,0 +1,56 @@
+/*
+  ==============================================================================
+
+    MeterFrameQueue.cpp
+    Created: 4 Mar 2026 8:22:51pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "MeterFrameQueue.h"
+
+void MeterFrame::merge(const MeterFrame& other) noexcept
+{
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        inputPeak[(size_t)ch] = juce::jmax(inputPeak[(size_t)ch], other.inputPeak[(size_t)ch]);
+        inputRms[(size_t)ch] = juce::jmax(inputRms[(size_t)ch], other.inputRms[(size_t)ch]);
+        outputPeak[(size_t)ch] = juce::jmax(outputPeak[(size_t)ch], other.outputPeak[(size_t)ch]);
+        outputRms[(size_t)ch] = juce::jmax(outputRms[(size_t)ch], other.outputRms[(size_t)ch]);
+    }
+
+    timestamp = juce::jmax(timestamp, other.timestamp);
+}
+
+MeterFrameQueue::MeterFrameQueue(int capacity)
+    : fifo(capacity), frames((size_t)capacity)
+{
+}
+
+void MeterFrameQueue::push(const MeterFrame& frame) noexcept
+{
+    if (hasPending)
+    {
+        pending.merge(frame);
+        hasPending = !tryWrite(pending);
+        return;
+    }
+
+    if (!tryWrite(frame))
+    {
+        pending = frame;
+        hasPending = true;
+    }
+}
+
+bool MeterFrameQueue::tryWrite(const MeterFrame& frame) noexcept
+{
+    const auto scope = fifo.write(1);
+
+    if (scope.blockSize1 + scope.blockSize2 == 0)
+        return false;
+
+    frames[(size_t)(scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2)] = frame;
+    return true;
+}
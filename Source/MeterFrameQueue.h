@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+
+    MeterFrameQueue.h
+    Created: 4 Mar 2026 8:22:51pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// Medição de um bloco (L/R; um bus mono repete o canal único)
+struct MeterFrame
+{
+    static constexpr int numChannels = 2;
+
+    std::array<float, numChannels> inputPeak{}, inputRms{};
+    std::array<float, numChannels> outputPeak{}, outputRms{};
+    double timestamp = 0.0; // segundos (Time::getMillisecondCounterHiRes) no fim do bloco
+
+    // Junta dois frames num só (usado quando a fila enche)
+    void merge(const MeterFrame& other) noexcept;
+};
+
+// Fila SPSC lock-free de frames de medição: o audio thread escreve um frame por
+// bloco e a UI consome todos, na ordem, sem nunca escrever de volta.
+class MeterFrameQueue
+{
+public:
+    explicit MeterFrameQueue(int capacity = 1024);
+
+    // Audio thread: nunca bloqueia nem aloca. Com a fila cheia o frame é acumulado
+    // e entra no próximo push, para nenhum pico se perder.
+    void push(const MeterFrame& frame) noexcept;
+
+    // Message thread: entrega os frames prontos em ordem; retorna quantos
+    template <typename Callback>
+    int popAll(Callback&& callback)
+    {
+        const auto scope = fifo.read(fifo.getNumReady());
+
+        for (int i = scope.startIndex1; i < scope.startIndex1 + scope.blockSize1; ++i)
+            callback(frames[(size_t)i]);
+
+        for (int i = scope.startIndex2; i < scope.startIndex2 + scope.blockSize2; ++i)
+            callback(frames[(size_t)i]);
+
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+private:
+    bool tryWrite(const MeterFrame& frame) noexcept;
+
+    juce::AbstractFifo fifo;
+    std::vector<MeterFrame> frames;
+
+    // Só o audio thread toca
+    MeterFrame pending;
+    bool hasPending = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MeterFrameQueue)
+};
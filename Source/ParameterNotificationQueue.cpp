@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+
+    ParameterNotificationQueue.cpp
+    Created: 2 Mar 2026 9:48:16pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "ParameterNotificationQueue.h"
+
+ParameterNotificationQueue::ParameterNotificationQueue(int capacity)
+    : fifo(capacity), events((size_t)capacity)
+{
+    startTimerHz(30);
+}
+
+ParameterNotificationQueue::~ParameterNotificationQueue()
+{
+    stopTimer();
+}
+
+bool ParameterNotificationQueue::post(juce::RangedAudioParameter* parameter, float normalisedValue) noexcept
+{
+    const auto scope = fifo.write(1);
+
+    if (scope.blockSize1 + scope.blockSize2 == 0)
+        return false;
+
+    auto& event = events[(size_t)(scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2)];
+    event.parameter = parameter;
+    event.value = normalisedValue;
+    return true;
+}
+
+void ParameterNotificationQueue::timerCallback()
+{
+    const auto scope = fifo.read(fifo.getNumReady());
+
+    auto notify = [this](int start, int size)
+    {
+        for (int i = start; i < start + size; ++i)
+        {
+            auto& event = events[(size_t)i];
+
+            // O valor pode já estar certo (evento antigo ou mudança pela UI)
+            if (event.parameter->getValue() != event.value)
+                event.parameter->setValueNotifyingHost(event.value);
+        }
+    };
+
+    notify(scope.startIndex1, scope.blockSize1);
+    notify(scope.startIndex2, scope.blockSize2);
+}
@@ -0,0 +1,39 @@
+/*
+  ==============================================================================
+
+    ParameterNotificationQueue.h
+    Created: 2 Mar 2026 9:48:16pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// Fila SPSC lock-free de notificações de parâmetro: o audio thread só posta o
+// evento e o message thread (timer) faz o setValueNotifyingHost, que em vários
+// hosts trava, aloca e dispara listeners de UI.
+class ParameterNotificationQueue : private juce::Timer
+{
+public:
+    explicit ParameterNotificationQueue(int capacity = 64);
+    ~ParameterNotificationQueue() override;
+
+    // Audio thread: nunca bloqueia nem aloca. Retorna false se a fila estiver cheia.
+    bool post(juce::RangedAudioParameter* parameter, float normalisedValue) noexcept;
+
+private:
+    void timerCallback() override;
+
+    struct Event
+    {
+        juce::RangedAudioParameter* parameter = nullptr;
+        float value = 0.0f;
+    };
+
+    juce::AbstractFifo fifo;
+    std::vector<Event> events;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterNotificationQueue)
+};
@@ -14,43 +14,6 @@
 #include "PluginEditor.h"
 
 
-//Carrega a fonte do Titulo do PLugin
-juce::Font static getFrankRuehlFont(float height)
-{
-    static auto typeface = juce::Typeface::createSystemTypefaceFor(
-        BinaryData::FrankRuehlCLM_ttf,
-        BinaryData::FrankRuehlCLM_ttfSize
-    );
-
-    // Cria a juce::Font com FontOptions e o Typeface carregado
-    return juce::Font(juce::FontOptions(typeface).withHeight(height));
-}
-
-//Carrega a fonte do Titulo da marca
-juce::Font static getLatoBlackFont(float height)
-{
-    static auto typeface = juce::Typeface::createSystemTypefaceFor(
-        BinaryData::LatoBlack_ttf,
-        BinaryData::LatoBlack_ttfSize
-    );
-
-    // Cria a juce::Font com FontOptions e o Typeface carregado
-    return juce::Font(juce::FontOptions(typeface).withHeight(height));
-}
-
-//Carrega a fonte do estilo do botão telefy
-juce::Font static getPHONESFont(float height)
-{
-    // Usando o nome exato do recurso confirmado pelo usuário.
-    static auto typeface = juce::Typeface::createSystemTypefaceFor(
-        BinaryData::PHONES_TTF,
-        BinaryData::PHONES_TTFSize
-    );
-
-    // Cria a juce::Font com FontOptions e o Typeface carregado
-    return juce::Font(juce::FontOptions(typeface).withHeight(height));
-}
-
 /* /aboutPanel::aboutPanel()
 {
     // O painel INTEIRO (o overlay) precisa ser transparente para o efeito dimmer.
@@ -206,9 +169,6 @@ TeLeQAudioProcessorEditor::TeLeQAudioProcessorEditor(TeLeQAudioProcessor& p)
     addAndMakeVisible(outputMeterL);
     addAndMakeVisible(outputMeterR);
 
-    // Inicia o timer para atualizar a UI 30 vezes por segundo
-    startTimerHz(50);
-
     // Anexo do HPF Slope
     hpfSlopeAttachment = std::make_unique<ComboBoxAttachment>(
         audioProcessor.apvts,
@@ -235,7 +195,7 @@ TeLeQAudioProcessorEditor::TeLeQAudioProcessorEditor(TeLeQAudioProcessor& p)
         telefyModeBox
 	);
 
-    setLookAndFeel(&customLookAndFeel);
+    setLookAndFeel(&assets->getLookAndFeel());
 
 
     lowShelfBellButton.setClickingTogglesState(true);
@@ -336,14 +296,23 @@ TeLeQAudioProcessorEditor::TeLeQAudioProcessorEditor(TeLeQAudioProcessor& p)
     }
 
 
-    setSize(500, 600);
+    // Primeiro filho e no fundo: os knobs do EQ ficam por cima do espectro
+    spectrumDisplay = std::make_unique<SpectrumDisplay>(audioProcessor.getPreSpectrum(), audioProcessor.getPostSpectrum());
+    addAndMakeVisible(*spectrumDisplay);
+    spectrumDisplay->toBack();
 
-    auto tempLogoDrawable = juce::Drawable::createFromImageData(
+    // Curva do EQ logo acima do espectro, ainda atrás dos knobs
+    responseCurveDisplay = std::make_unique<ResponseCurveDisplay>(audioProcessor.getResponseCurveSource());
+    addAndMakeVisible(*responseCurveDisplay);
+    responseCurveDisplay->toBack();
+    spectrumDisplay->toBack();
 
-        BinaryData::Logo_svg,
-        BinaryData::Logo_svgSize);
+    // A camada estática cobre o editor inteiro
+    setOpaque(true);
+    setSize(500, 600);
 
-    if (tempLogoDrawable)
+    // SVG parseado uma vez por processo (EditorAssets)
+    if (auto* logoDrawable = assets->getLogo())
     {
         // 1. CRIAÇÃO: O logoImage DEVE ser inicializado primeiro
         logoImage = std::make_unique<juce::DrawableButton>("About", juce::DrawableButton::ImageFitted);
@@ -352,9 +321,8 @@ TeLeQAudioProcessorEditor::TeLeQAudioProcessorEditor(TeLeQAudioProcessor& p)
         // logoImage->setAlwaysOnTop(true); // Remova, pois não é estritamente necessário e pode causar problemas
         logoImage->setColour(juce::TextButton::buttonColourId, juce::Colours::red); // Diagnóstico visual
 
-        // 3. setImages e Transferência de Propriedade (Correta)
-        logoImage->setImages(tempLogoDrawable.get());
-        tempLogoDrawable.release();
+        // 3. setImages guarda uma cópia do drawable
+        logoImage->setImages(logoDrawable);
 
         // 3. Estado inicial: (Garantir que o texto seja exibido)
         lowShelfBellButton.setButtonText("SHELF");
@@ -378,7 +346,8 @@ TeLeQAudioProcessorEditor::TeLeQAudioProcessorEditor(TeLeQAudioProcessor& p)
 TeLeQAudioProcessorEditor::~TeLeQAudioProcessorEditor()
 
 {
-    stopTimer();
+    // O look-and-feel é compartilhado e sobrevive a este editor
+    setLookAndFeel(nullptr);
 }
 
 juce::Path TeLeQAudioProcessorEditor::createHighQPath(juce::Rectangle<int> area)
@@ -426,56 +395,75 @@ float gainToNormalizedDb(float gain, float minDb = -60.0f, float maxDb = 0.0f)
     return juce::jlimit(0.0f, 1.0f, normalized);
 }
 
-void TeLeQAudioProcessorEditor::timerCallback()
+void TeLeQAudioProcessorEditor::updateMeters()
 {
-    // 1. Decaimento e Leitura dos Picos
-    // O decaimento suave (multiplicar por 0.95) é crucial para que o medidor caia lentamente
-
-    DBG("Timer ativo!");
-
-    // === INPUT METERS ===
-    // Canal L
-    float decayedInputL = audioProcessor.getInputPeakL() * 0.95f;
-    float inputDbL = gainToNormalizedDb(decayedInputL);
-    inputMeterL.update(inputDbL);
-    DBG("Input L: " << juce::Decibels::gainToDecibels(decayedInputL) << " dB");
-
-    // Canal R
-    float decayedInputR = audioProcessor.getInputPeakR() * 0.95f;
-    float inputDbR = gainToNormalizedDb(decayedInputR);
-    inputMeterR.update(inputDbR);
-    DBG("Input R: " << juce::Decibels::gainToDecibels(decayedInputR) << " dB");
-
-    // === OUTPUT METERS ===
-    // Canal L
-    float decayedOutputL = audioProcessor.getOutputPeakL() * 0.95f;
-    float outputDbL = gainToNormalizedDb(decayedOutputL);
-    outputMeterL.update(outputDbL);
-    DBG("Output L: " << juce::Decibels::gainToDecibels(decayedOutputL) << " dB");
-
-    // Canal R
-    float decayedOutputR = audioProcessor.getOutputPeakR() * 0.95f;
-    float outputDbR = gainToNormalizedDb(decayedOutputR);
-    outputMeterR.update(outputDbR);
-    DBG("Output R: " << juce::Decibels::gainToDecibels(decayedOutputR) << " dB");
-
-    // === ATUALIZAR OS VALORES ATÔMICOS NO PROCESSOR ===
-    // Use .store() para atribuir valores a std::atomic
-    audioProcessor.inputPeakL.store(decayedInputL);
-    audioProcessor.inputPeakR.store(decayedInputR);
-    audioProcessor.outputPeakL.store(decayedOutputL);
-    audioProcessor.outputPeakR.store(decayedOutputR);
+    if (!isShowing())
+        return;
+
+    // Consome todos os frames (um por bloco de áudio) em ordem: a balística
+    // usa os timestamps dos frames, não a taxa do vblank
+    const int numFrames = audioProcessor.getMeterFrames().popAll([this](const MeterFrame& frame)
+    {
+        for (size_t ch = 0; ch < MeterFrame::numChannels; ++ch)
+        {
+            inputBallistics[ch].addFrame(frame.inputPeak[ch], frame.inputRms[ch], frame.timestamp);
+            outputBallistics[ch].addFrame(frame.outputPeak[ch], frame.outputRms[ch], frame.timestamp);
+        }
+    });
+
+    // Sem frames novos e tudo já no chão: nada muda até o áudio voltar
+    if (numFrames == 0 && metersAtRest)
+        return;
+
+    // Sem frames novos (transporte parado) os meters continuam caindo
+    const double now = juce::Time::getMillisecondCounterHiRes() * 0.001;
+
+    auto updateMeter = [now](BarMeterComponent& meter, MeterBallistics& ballistics)
+    {
+        ballistics.advanceTo(now);
+        meter.update(gainToNormalizedDb(ballistics.getPeak()),
+                     gainToNormalizedDb(ballistics.getRms()),
+                     gainToNormalizedDb(ballistics.getPeakHold()));
+    };
+
+    updateMeter(inputMeterL, inputBallistics[0]);
+    updateMeter(inputMeterR, inputBallistics[1]);
+    updateMeter(outputMeterL, outputBallistics[0]);
+    updateMeter(outputMeterR, outputBallistics[1]);
+
+    metersAtRest = std::all_of(inputBallistics.begin(), inputBallistics.end(), [](const auto& b) { return b.isAtRest(); })
+                && std::all_of(outputBallistics.begin(), outputBallistics.end(), [](const auto& b) { return b.isAtRest(); });
 }
 
 
 //==============================================================================
 
 void TeLeQAudioProcessorEditor::paint(juce::Graphics& g)
+{
+    // Repaints de knobs e meters só copiam a camada estática, já na escala física
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+    if (!chromeLayer.isValid() || scale != chromeLayerScale)
+    {
+        chromeLayerScale = scale;
+        chromeLayer = juce::Image(juce::Image::RGB,
+                                  juce::jmax(1, juce::roundToInt((float)getWidth() * scale)),
+                                  juce::jmax(1, juce::roundToInt((float)getHeight() * scale)),
+                                  false);
+
+        juce::Graphics chromeGraphics(chromeLayer);
+        chromeGraphics.addTransform(juce::AffineTransform::scale(scale));
+        paintChrome(chromeGraphics);
+    }
+
+    g.drawImage(chromeLayer, getLocalBounds().toFloat());
+}
 
+void TeLeQAudioProcessorEditor::paintChrome(juce::Graphics& g)
 {
-    DBG("Editor paint...");
     //Carrega a imagem de fundo com gradiente via BinaryData
-    g.drawImage(backgroundImage,
+    // Já reamostrado para o tamanho físico da camada: a cópia é 1:1
+    g.drawImage(assets->getBackground(chromeLayer.getWidth(), chromeLayer.getHeight()),
         getLocalBounds().toFloat(),
         juce::RectanglePlacement::stretchToFit);
 
@@ -592,13 +580,13 @@ void TeLeQAudioProcessorEditor::paint(juce::Graphics& g)
 
     //desenha o SYMBOL
     g.setColour(juce::Colour(0xFF507B88));
-    g.setFont(getPHONESFont(60.0f));
+    g.setFont(assets->getFont(EditorAssets::FontId::Phones, 60.0f));
     g.drawFittedText("T", symbolArea,
     juce::Justification::centred, 1);
 
     //Desenha o BRAND TITTLE        
     g.setColour(juce::Colour(0xFF507B88));
-    g.setFont(getLatoBlackFont(25.0f));
+    g.setFont(assets->getFont(EditorAssets::FontId::LatoBlack, 25.0f));
     g.drawFittedText("CRAB AUDIO", brandArea,
     juce::Justification::centred, 1);
 
@@ -652,10 +640,8 @@ void TeLeQAudioProcessorEditor::resized()
     // [MANTER] 'bounds' é a referência para o gradiente e os elementos externos (Logo, Title, Brand Title).
     auto bounds = getLocalBounds().toFloat();
 
-    backgroundImage = juce::ImageFileFormat::loadFrom(
-        BinaryData::Background_png,
-        BinaryData::Background_pngSize
-    );
+    // Layout novo: a camada estática é refeita no próximo paint
+    chromeLayer = {};
 
     // === 3. CALCULAR POSIÇÃO E TAMANHO DO PAINEL PRINCIPAL ===
     float headerMargin = bounds.getHeight() * 0.05f;
@@ -752,6 +738,12 @@ void TeLeQAudioProcessorEditor::resized()
     // [ALTERADO/COMENTADO]: Cria uma cópia da área para fazer a divisão vertical destrutiva.
     auto layoutArea = mainPanelArea.toNearestInt().reduced(10);
 
+    if (spectrumDisplay)
+        spectrumDisplay->setBounds(layoutArea);
+
+    if (responseCurveDisplay)
+        responseCurveDisplay->setBounds(layoutArea);
+
     // Altura reservada para a fileira de filtros na base (aprox. 15% do espaço vertical)
     int filterHeight = layoutArea.getHeight() / 7;
 
@@ -1181,7 +1173,28 @@ void TeLeQAudioProcessorEditor::resized()
     {
         aboutOverlay->setBounds(getLocalBounds());
     }
+
+   #if TELEQ_ENABLE_PROFILING
+    if (diagnosticsPanel)
+        diagnosticsPanel->setBounds(getLocalBounds().removeFromBottom(150).reduced(10));
+   #endif
+}
+
+#if TELEQ_ENABLE_PROFILING
+void TeLeQAudioProcessorEditor::toggleDiagnosticsPanel()
+{
+    if (diagnosticsPanel)
+    {
+        diagnosticsPanel.reset();
+        return;
+    }
+
+    diagnosticsPanel = std::make_unique<DiagnosticsPanel>(audioProcessor.getProfiler());
+    addAndMakeVisible(*diagnosticsPanel);
+    diagnosticsPanel->setAlwaysOnTop(true);
+    resized();
 }
+#endif
 
 std::vector<juce::Component*> TeLeQAudioProcessorEditor::getComps()
 
@@ -1208,6 +1221,15 @@ std::vector<juce::Component*> TeLeQAudioProcessorEditor::getComps()
 
 void TeLeQAudioProcessorEditor::buttonClicked(juce::Button* button)
 {
+   #if TELEQ_ENABLE_PROFILING
+    // Painel de diagnóstico escondido: Alt + clique no logo
+    if (logoImage && button == logoImage.get() && juce::ModifierKeys::currentModifiers.isAltDown())
+    {
+        toggleDiagnosticsPanel();
+        return;
+    }
+   #endif
+
     if (button == &lowShelfBellButton)
     {
         // O estado interno do botão (isDown) já foi alternado pelo setClickingTogglesState(true).
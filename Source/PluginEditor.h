@@ -13,8 +13,13 @@
 #include "PluginProcessor.h"
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "CustomLookAndFeel.h"
+#include "EditorAssets.h"
+#include "SpectrumDisplay.h"
+#include "ResponseCurveDisplay.h"
 #include "HorizontalSelector.h"
 #include "CustomSlider.h"
+#include "DiagnosticsPanel.h"
+#include "MeterBallistics.h"
 
 
 class aboutPanel : public juce::Component
@@ -55,8 +60,7 @@ struct CustomRotarySlider : public CustomSlider
 /**
 */
 class TeLeQAudioProcessorEditor  : public juce::AudioProcessorEditor,
-                                   public juce::Button::Listener,
-                                   juce::Timer
+                                   public juce::Button::Listener
                                //    public juce::ListBoxModel
 {
 public:
@@ -81,15 +85,27 @@ private:
     // access the processor object that created it.
    // juce::Grid bandGrid;
     TeLeQAudioProcessor& processorRef;
-    juce::Image backgroundImage;
-    CustomLookAndFeel customLookAndFeel;
+    // Logo, fundo, fontes e look-and-feel compartilhados entre as instâncias
+    juce::SharedResourcePointer<EditorAssets> assets;
+
+    // Fundo, divisórias, títulos e painéis renderizados uma vez por tamanho/escala
+    juce::Image chromeLayer;
+    float chromeLayerScale = 0.0f;
+    void paintChrome(juce::Graphics& g);
 
     BarMeterComponent inputMeterL;
     BarMeterComponent inputMeterR;
     BarMeterComponent outputMeterL;
     BarMeterComponent outputMeterR;
 
-    void timerCallback() override; // callback do Timer
+    // Balística por canal (L/R), alimentada pelos frames do processor
+    std::array<MeterBallistics, MeterFrame::numChannels> inputBallistics, outputBallistics;
+    bool metersAtRest = true;
+
+    // Meters atualizados no vblank do monitor; sem peer (editor fechado ou
+    // escondido) não há callback
+    void updateMeters();
+    juce::VBlankAttachment meterVBlank{ this, [this] { updateMeters(); } };
 
     juce::Rectangle<float> drivePanel;      // Painel de Saturação (Esquerda)
     juce::Rectangle<float> telefyPanel;     // Painel do Filtro Telefônico (Direita)
@@ -191,8 +207,18 @@ private:
     juce::ColourGradient backgroundGradient;
 
     std::unique_ptr<juce::DrawableButton> logoImage;
+
+    // Analisador pré/pós atrás das bandas do EQ; o thread da FFT vive com o editor
+    std::unique_ptr<SpectrumDisplay> spectrumDisplay;
+    std::unique_ptr<ResponseCurveDisplay> responseCurveDisplay;
     std::unique_ptr<aboutPanel> aboutOverlay;
 
+   #if TELEQ_ENABLE_PROFILING
+    // Criado só quando aberto (Alt + clique no logo), para não ter timer rodando escondido
+    std::unique_ptr<DiagnosticsPanel> diagnosticsPanel;
+    void toggleDiagnosticsPanel();
+   #endif
+
 
 
 
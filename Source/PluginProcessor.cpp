@@ -11,109 +11,47 @@
 
 namespace
 {
-    // ===== Tape Saturator (pre-emphasis + soft shaper + de-emphasis) =====
-    static double tapeSaturator(double x, SaturatorFilters& f)
+    // Saturação em estágios de bloco: pré-ênfase -> shaper (SaturatorKernels,
+    // vetorizável) -> de-ênfase. Cada filtro roda um passe próprio sobre o bloco.
+    void processFilterBlock(juce::dsp::IIR::Filter<double>& filter, double* data, int numSamples) noexcept
     {
-        // PRE-EMPHASIS
-        x = f.pre1.processSample(x);
-        x = f.pre2.processSample(x);
-
-        // saturação (SoftClippper assimétrico)
-        double a = x + 0.04 * x * x;
-        double sat = std::tanh(a * 0.9);
-
-		// POST-DE-EMPHASIS
-        sat = f.post1.processSample(sat);
-        sat = f.post2.processSample(sat);
-        sat = f.post3.processSample(sat);
-
-        return sat;
-    }
-
-    // ===== Tube Saturator (triode-like) =====
-    static double tubeSaturator(double x, SaturatorFilters& f)
-    {
-		// PRE-EMPHASIS 
-        x = f.pre1.processSample(x);
-        x = f.pre2.processSample(x);
-
-		// saturação (modelo polinomial de tríodo)
-        double x2 = x * x;
-        double x4 = x2 * x2;
-        double nonlin = 0.85 * x + 0.15 * x2 + 0.04 * x4;
-        double sat = std::tanh(nonlin * 1.1);
-
-		// POST-DE-EMPHASIS 
-        sat = f.post1.processSample(sat);
-        sat = f.post2.processSample(sat);
-
-        return sat;
-    }
-
-    // ===== FET Saturator (knee rapido / compressivo) =====
-    static double fetSaturator(double x, SaturatorFilters& f)
-    {
-		// PRE-EMPHASIS 
-        x = f.pre1.processSample(x);
-        x = f.pre2.processSample(x);
-
-		// saturação (soft-knee estilo FET)
-        double a = x + 0.03 * x * x;
-        double sat = a / (1.0 + 0.55 * std::abs(a));
-
-		// POST-DE-EMPHASIS 
-        sat = f.post1.processSample(sat);
-		sat = f.post2.processSample(sat);
+        for (int i = 0; i < numSamples; ++i)
+            data[i] = filter.processSample(data[i]);
 
-        return sat;
+        filter.snapToZero();
     }
-}
 
-namespace TelefySat
-{
-    // === 1. Telefy FET+ (hiper agressivo) ===
-    static inline double fetPlus(double x)
+    template <template <typename> class Shaper>
+    void runDriveModel(SaturatorFilters& f, int numPostFilters, double* data, int numSamples,
+                       SaturatorKernels::Mode mode, SaturatorOversampling& oversampling, int channel, int slot)
     {
-        // Assimetria forte
-        double a = x + 0.10 * x * x;
+        // PRE-EMPHASIS
+        processFilterBlock(f.pre1, data, numSamples);
+        processFilterBlock(f.pre2, data, numSamples);
 
-        // FET soft-knee
-        double knee = a / (1.0 + 0.35 * std::abs(a));
+        // saturação (na taxa do oversampling)
+        oversampling.process(channel, slot, data, numSamples, [mode](double* upsampled, int numUpsampled)
+        {
+            SaturatorKernels::apply<Shaper>(upsampled, numUpsampled, mode);
+        });
 
-        // Arredonda topo (simulação de saturação do drain)
-        double sat = std::tanh(knee * 1.5);
+        // POST-DE-EMPHASIS
+        processFilterBlock(f.post1, data, numSamples);
+        processFilterBlock(f.post2, data, numSamples);
 
-        return sat;
+        if (numPostFilters > 2)
+            processFilterBlock(f.post3, data, numSamples);
     }
 
-    // === 2. Telefy Rasp (AM clipping / telefonização distorcida) ===
-    static inline double rasp(double x)
+    // Mistura o kernel antigo (fadeOut) no novo (output) seguindo a rampa do crossfade
+    void applySaturatorCrossfade(const SaturatorCrossfade& fade, const double* fadeOut, double* output, int numSamples) noexcept
     {
-        // Assimetria típica de AM overdrive
-        double a = x + 0.12 * x * x;
-
-        // Overdrive forte com tanh
-        double b = std::tanh(a * 2.4);
-
-        // raspagem (mistura polinomial)
-        double rasp = 0.7 * b + 0.3 * (b * b);
-
-        return rasp;
-    }
-    // ===== Função Wrapper =====
-    static double telefySaturator(double x, int type)
-    {
-        switch (type)
+        for (int i = 0; i < numSamples; ++i)
         {
-        case 0: return fetPlus(x); // "Distort"
-        case 1: return rasp(x); // "Obliterate"
-        default: return x;
+            const double g = fade.getNewGain(i);
+            output[i] = fadeOut[i] + g * (output[i] - fadeOut[i]);
         }
     }
-
-
-
-
 }
 
 
@@ -132,11 +70,16 @@ TeLeQAudioProcessor::TeLeQAudioProcessor()
                        )
 #endif
 {
+    // Mesma ordem de postActivationStates
+    activationParameters = { parameters.hpfActive, parameters.lpfActive,
+                             parameters.driveActive, parameters.telefyActive };
 
+    startTimerHz(10);
 }
 
 TeLeQAudioProcessor::~TeLeQAudioProcessor()
 {
+    stopTimer();
 }
 
 //==============================================================================
@@ -174,6 +117,12 @@ bool TeLeQAudioProcessor::isMidiEffect() const
 
 double TeLeQAudioProcessor::getTailLengthSeconds() const
 {
+    // O FIR de fase linear ainda soa meia janela depois da latência
+    const int tailSamples = linearPhaseTailSamples.load(std::memory_order_relaxed);
+
+    if (tailSamples > 0 && getSampleRate() > 0.0)
+        return tailSamples / getSampleRate();
+
     return 0.0;
 }
 
@@ -212,82 +161,117 @@ void TeLeQAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     spec.numChannels = getTotalNumOutputChannels(); //1; 
     spec.sampleRate = sampleRate;
 
-    leftChain.prepare(spec);
-    rightChain.prepare(spec);
+    // Pool de estado por canal, dimensionado para o layout atual
+    prepareChannelStates((int)spec.numChannels, sampleRate, samplesPerBlock);
+
+    prepareCoefficientStorage();
+    activeEqEngine = eqEngine.load();
+    resetEqState();
 
-    leftTelefyChain.prepare(spec);
-    rightTelefyChain.prepare(spec);
+    TELEQ_PROFILE(profiler.prepare(sampleRate));
+    preSpectrum.setSampleRate(sampleRate);
+    responseCurve.setSampleRate(sampleRate);
+    postSpectrum.setSampleRate(sampleRate);
+
+    // Rampa de 50 ms para os parâmetros contínuos do EQ e do Telefy
+    eqSmoother.reset(sampleRate, 0.05, parameters.makeSnapshot());
 
-    // inicializa auto gain por canal (usa numero de canais de saida)
-    autoGains.clear();
-    autoGains.resize((size_t)spec.numChannels);
     driveSmoothed.reset(sampleRate, 0.02); // 20 ms suave
 
-    // === PREPARE SATURATOR FILTERS ===
-    for (int ch = 0; ch < getTotalNumOutputChannels(); ++ch)
-    {
-        auto spec = juce::dsp::ProcessSpec{ sampleRate, (juce::uint32)samplesPerBlock, 1 };
+    // Crossfade de 10 ms na troca do tipo de saturação
+    const int saturatorFadeLength = juce::roundToInt(sampleRate * 0.01);
+    const auto initialSettings = parameters.makeSnapshot();
+    driveCrossfade.reset(initialSettings.driveType, saturatorFadeLength);
+    telefyCrossfade.reset(initialSettings.telefySatType, saturatorFadeLength);
 
-        tapeFilters[ch].pre1.prepare(spec);
-        tapeFilters[ch].pre2.prepare(spec);
-        tapeFilters[ch].post1.prepare(spec);
-        tapeFilters[ch].post2.prepare(spec);
-		tapeFilters[ch].post3.prepare(spec);
+    prepareScratchBuffers(juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels()), samplesPerBlock);
+    configureOversampling();
 
-        tubeFilters[ch].pre1.prepare(spec);
-        tubeFilters[ch].pre2.prepare(spec);
-        tubeFilters[ch].post1.prepare(spec);
-        tubeFilters[ch].post2.prepare(spec);
+    updateFilters(); 
 
-        fetFilters[ch].pre1.prepare(spec);
-        fetFilters[ch].pre2.prepare(spec);
-        fetFilters[ch].post1.prepare(spec);
-        fetFilters[ch].post2.prepare(spec);
-    }
-    //Prepare Tape Filters
-    for (int ch = 0; ch < getTotalNumOutputChannels(); ++ch)
-    {
-        // --- PRE (Muito sutil - apenas proteção de subsônicos) ---
-        tapeFilters[ch].pre1.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);  // Remove DC
-        tapeFilters[ch].pre2.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);  // Bypass (mesmo filtro)
+    // Depois do updateFilters: o primeiro kernel sai dos coeficientes já publicados
+    configureLinearPhase();
+}
 
-        // --- POST (Muito suave - apenas suavização) ---
-        tapeFilters[ch].post1.coefficients = juce::dsp::IIR::Coefficients<double>::makeLowPass(sampleRate, 21000.0);  // Proteção de aliasing
-        tapeFilters[ch].post2.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);    // Neutral
-        tapeFilters[ch].post3.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);    // Neutral
-    }
+void TeLeQAudioProcessor::prepareChannelStates(int numChannels, double sampleRate, int maxBlockSize)
+{
+    numChannels = juce::jlimit(1, maxNumChannels, numChannels);
 
-    //Prepare Tube Filters
-    for (int ch = 0; ch < getTotalNumOutputChannels(); ++ch)
-    {
-        // --- PRE (Apenas proteção) ---
-        tubeFilters[ch].pre1.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);   // Remove DC
-        tubeFilters[ch].pre2.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);   // Neutral
+    // Um único bloco contíguo; reconstruído só aqui, fora do audio thread
+    channelStates = std::make_unique<ChannelState[]>((size_t)numChannels);
+    numChannelStates = numChannels;
 
-        // --- POST (Apenas proteção de aliasing) ---
-        tubeFilters[ch].post1.coefficients = juce::dsp::IIR::Coefficients<double>::makeLowPass(sampleRate, 21000.0); // Proteção
-        tubeFilters[ch].post2.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);   // Neutral
-    }
+    // Cada canal é processado como um bloco mono
+    const juce::dsp::ProcessSpec monoSpec{ sampleRate, (juce::uint32)maxBlockSize, 1 };
 
-    //Prepare FET Filters
-    for (int ch = 0; ch < getTotalNumOutputChannels(); ++ch)
+    auto prepareFilters = [&monoSpec](SaturatorFilters& f)
+    {
+        for (auto* filter : { &f.pre1, &f.pre2, &f.post1, &f.post2, &f.post3 })
+            filter->prepare(monoSpec);
+    };
+
+    for (int ch = 0; ch < numChannels; ++ch)
     {
-        // --- PRE (Apenas proteção) ---
-        fetFilters[ch].pre1.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);    // Remove DC
-        fetFilters[ch].pre2.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);    // Neutral
+        auto& state = channelStates[ch];
+
+        state.eqChain.prepare(monoSpec);
+        state.telefyChain.prepare(monoSpec);
+
+        // Slot TelefyBandPass do MonoChain nunca é usado (o Telefy tem cadeia própria)
+        state.eqChain.setBypassed<ChainPositions::TelefyBandPass>(true);
+
+        state.driveAutoGain.prepare(sampleRate);
+        state.telefyAutoGain.prepare(sampleRate);
+
+        prepareFilters(state.tapeFilters);
+        prepareFilters(state.tubeFilters);
+        prepareFilters(state.fetFilters);
+
+        // --- Tape ---
+        // PRE (Muito sutil - apenas proteção de subsônicos)
+        state.tapeFilters.pre1.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);  // Remove DC
+        state.tapeFilters.pre2.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);  // Bypass (mesmo filtro)
+
+        // POST (Muito suave - apenas suavização)
+        state.tapeFilters.post1.coefficients = juce::dsp::IIR::Coefficients<double>::makeLowPass(sampleRate, 21000.0);  // Proteção de aliasing
+        state.tapeFilters.post2.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);    // Neutral
+        state.tapeFilters.post3.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);    // Neutral
 
-        // --- POST (Apenas proteção de aliasing) ---
-        fetFilters[ch].post1.coefficients = juce::dsp::IIR::Coefficients<double>::makeLowPass(sampleRate, 21000.0);  // Proteção
-        fetFilters[ch].post2.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);   // Neutral
+        // --- Tube ---
+        // PRE (Apenas proteção)
+        state.tubeFilters.pre1.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);   // Remove DC
+        state.tubeFilters.pre2.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);   // Neutral
+
+        // POST (Apenas proteção de aliasing)
+        state.tubeFilters.post1.coefficients = juce::dsp::IIR::Coefficients<double>::makeLowPass(sampleRate, 21000.0); // Proteção
+        state.tubeFilters.post2.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);   // Neutral
+
+        // --- FET ---
+        // PRE (Apenas proteção)
+        state.fetFilters.pre1.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);    // Remove DC
+        state.fetFilters.pre2.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);    // Neutral
+
+        // POST (Apenas proteção de aliasing)
+        state.fetFilters.post1.coefficients = juce::dsp::IIR::Coefficients<double>::makeLowPass(sampleRate, 21000.0);  // Proteção
+        state.fetFilters.post2.coefficients = juce::dsp::IIR::Coefficients<double>::makeHighPass(sampleRate, 20.0);   // Neutral
     }
 
-    driveSmoothed.reset(sampleRate, 0.02);
-    // ...
-    // Inicialize telefyAutoGain (assumindo que é um std::vector<AutoGainRMS>)
-    telefyAutoGain.clear();
-    telefyAutoGain.resize((size_t)spec.numChannels);
+    // Grupos de LinkedEq::numLanes canais consecutivos (o último pode ficar incompleto)
+    linkedEq.clear();
+    linkedEq.resize((size_t)((numChannels + LinkedEq::numLanes - 1) / LinkedEq::numLanes));
+}
 
-    updateFilters(); 
+void TeLeQAudioProcessor::prepareScratchBuffers(int numChannels, int maxBlockSize)
+{
+    // Toda a memoria usada pelo processBlock e alocada aqui, fora do audio thread
+    scratchCapacity = juce::jmax(1, maxBlockSize);
+
+    doubleBuffer.setSize(numChannels, scratchCapacity);
+    telefyBuffer.setSize(numChannels, scratchCapacity);
+    saturatorScratch.setSize(SaturatorScratch::NumChannels, scratchCapacity);
+    doubleBuffer.clear();
+    telefyBuffer.clear();
+    saturatorScratch.clear();
 }
 void TeLeQAudioProcessor::releaseResources()
 {
@@ -302,12 +286,10 @@ bool TeLeQAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) co
     juce::ignoreUnused (layouts);
     return true;
   #else
-    // This is the place where you check if the layout is supported.
-    // In this template code we only support mono or stereo.
-    // Some plugin hosts, such as certain GarageBand versions, will only
-    // load plugins that support stereo bus layouts.
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Qualquer layout (mono, estéreo, 5.1, 7.1, 7.1.4...): o estado por canal é
+    // dimensionado no prepareToPlay
+    const auto& mainOutput = layouts.getMainOutputChannelSet();
+    if (mainOutput.isDisabled() || mainOutput.size() > maxNumChannels)
         return false;
 
     // This checks if the input layout matches the output layout
@@ -323,8 +305,67 @@ bool TeLeQAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) co
 
 void TeLeQAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
-    juce::ScopedNoDenormals noDenormals;
     juce::ignoreUnused(midiMessages);
+    processBlockInternal(buffer);
+}
+
+void TeLeQAudioProcessor::processBlock(juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused(midiMessages);
+    processBlockInternal(buffer);
+}
+
+void TeLeQAudioProcessor::processBlockBypassed(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused(midiMessages);
+    processBlockBypassedInternal(buffer);
+}
+
+void TeLeQAudioProcessor::processBlockBypassed(juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused(midiMessages);
+    processBlockBypassedInternal(buffer);
+}
+
+template <typename SampleType>
+void TeLeQAudioProcessor::processBlockBypassedInternal(juce::AudioBuffer<SampleType>& buffer)
+{
+    // O bypass do host atrasa a mesma latência reportada, senão a trilha anda no tempo
+    for (auto i = getTotalNumInputChannels(); i < getTotalNumOutputChannels(); ++i)
+        buffer.clear(i, 0, buffer.getNumSamples());
+
+    const int delayLength = bypassDelay.getNumSamples();
+    if (delayLength == 0)
+        return;
+
+    const int numChannels = juce::jmin(buffer.getNumChannels(), bypassDelay.getNumChannels());
+    const int numSamples = buffer.getNumSamples();
+    int position = bypassDelayPosition;
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto* data = buffer.getWritePointer(ch);
+        auto* line = bypassDelay.getWritePointer(ch);
+        position = bypassDelayPosition;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const double delayed = line[position];
+            line[position] = (double)data[i];
+            data[i] = (SampleType)delayed;
+
+            if (++position == delayLength)
+                position = 0;
+        }
+    }
+
+    bypassDelayPosition = position;
+}
+
+template <typename SampleType>
+void TeLeQAudioProcessor::processBlockInternal(juce::AudioBuffer<SampleType>& buffer)
+{
+    juce::ScopedNoDenormals noDenormals;
     auto totalNumInputChannels = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
@@ -332,111 +373,286 @@ void TeLeQAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
-    auto chainSettings = getChainSettings(apvts);
-    const int numChannels = buffer.getNumChannels();
-    const int numSamples = buffer.getNumSamples();
+    RealtimeGuard::ScopedNoAllocation noAllocation;
+    TELEQ_PROFILE(profiler.startBlock(buffer.getNumSamples()));
 
-    // =====================================================================
-    // CONVERSÃO FLOAT -> DOUBLE E GANHO DE ENTRADA
-    // =====================================================================
+    // Único snapshot dos parâmetros no bloco (loads atômicos relaxed)
+    const auto chainSettings = parameters.makeSnapshot();
 
-    juce::AudioBuffer<FilterCoefficientType> doubleBuffer(numChannels, numSamples);
-    doubleBuffer.clear();
+    // Plugin inteiro neutro (EQ plano, Drive/Telefy em 0, ganhos unitários):
+    // a saída é igual à entrada, então não há trabalho por amostra além dos meters
+    eqSmoother.setTargets(chainSettings);
+    const bool neutral = isNeutral(chainSettings);
+    responseCurve.setNeutral(neutral);
 
-    // Copia o sinal de entrada para doubleBuffer
-    for (int ch = 0; ch < numChannels; ++ch)
+    if (neutral)
     {
-        auto* srcFloat = buffer.getReadPointer(ch);
-        auto* destDouble = doubleBuffer.getWritePointer(ch);
-        for (int i = 0; i < numSamples; ++i)
-            destDouble[i] = static_cast<FilterCoefficientType>(srcFloat[i]);
+        postActivationStates(chainSettings);
+        updateNeutralMeters(buffer);
+        TELEQ_PROFILE(profiler.lap(StageProfiler::Output));
+        TELEQ_PROFILE(profiler.endBlock());
+        return;
     }
 
-    // Aplica o Ganho de Entrada
-    const double inputGain = juce::Decibels::decibelsToGain(chainSettings.inputGain);
-    doubleBuffer.applyGain(inputGain);
+    // Os buffers de trabalho foram dimensionados no prepareToPlay (avoidReallocating = true)
+    jassert(buffer.getNumSamples() <= scratchCapacity && buffer.getNumChannels() <= doubleBuffer.getNumChannels());
 
-    // Input Meters
-    if (numChannels >= 1)
+    if constexpr (std::is_same_v<SampleType, FilterCoefficientType>)
     {
-        auto peakL = doubleBuffer.getMagnitude(0, 0, numSamples);
-        inputPeakL.store(juce::jmax(inputPeakL.load(), static_cast<float>(peakL)));
-        DBG("Input L (post-gain): " << static_cast<float>(peakL));
+        // Host 64-bit: processa direto no buffer do host, sem conversao
+        processChain(buffer, chainSettings);
     }
+    else
+    {
+        // =====================================================================
+        // CONVERSÃO FLOAT -> DOUBLE -> FLOAT
+        // =====================================================================
+
+        doubleBuffer.makeCopyOf(buffer, true);
+
+        processChain(doubleBuffer, chainSettings);
+
+        buffer.makeCopyOf(doubleBuffer, true);
+    }
+
+    TELEQ_PROFILE(profiler.lap(StageProfiler::Output));
+    TELEQ_PROFILE(profiler.endBlock());
+}
+
+bool TeLeQAudioProcessor::isNeutral(const ChainSettings& chainSettings) const
+{
+    // Com rampa em andamento os coeficientes ainda não chegaram em 0 dB; com
+    // oversampling ligado o sinal ainda precisa atrasar a latência reportada
+    return !chainSettings.hpfActive && !chainSettings.lpfActive
+        && chainSettings.lowGain == 0.0 && chainSettings.lmfGain == 0.0
+        && chainSettings.hmfGain == 0.0 && chainSettings.highGain == 0.0
+        && chainSettings.Drive <= 0.0 && chainSettings.telefyAmount <= 0.0
+        && chainSettings.inputGain == 0.0 && chainSettings.outputGain == 0.0
+        && !eqSmoother.isSmoothing()
+        && getLatencySamples() == 0;
+}
+
+template <typename SampleType>
+void TeLeQAudioProcessor::updateNeutralMeters(const juce::AudioBuffer<SampleType>& buffer)
+{
+    // Entrada == saída: uma única medição por canal alimenta os dois meters
+    measureLevels(buffer, meterFrame.inputPeak, meterFrame.inputRms);
+    meterFrame.outputPeak = meterFrame.inputPeak;
+    meterFrame.outputRms = meterFrame.inputRms;
+    pushMeterFrame();
+
+    preSpectrum.push(buffer);
+    postSpectrum.push(buffer);
+}
 
-    if (numChannels >= 2)
+template <typename SampleType>
+void TeLeQAudioProcessor::measureLevels(const juce::AudioBuffer<SampleType>& buffer,
+                                        std::array<float, MeterFrame::numChannels>& peaks,
+                                        std::array<float, MeterFrame::numChannels>& rmsLevels)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int numChannels = buffer.getNumChannels();
+
+    for (int ch = 0; ch < MeterFrame::numChannels; ++ch)
     {
-        auto peakR = doubleBuffer.getMagnitude(1, 0, numSamples);
-        inputPeakR.store(juce::jmax(inputPeakR.load(), static_cast<float>(peakR)));
-        DBG("Input R (post-gain): " << static_cast<float>(peakR));
+        const int source = juce::jmin(ch, numChannels - 1);
+
+        peaks[(size_t)ch] = source >= 0 ? (float)buffer.getMagnitude(source, 0, numSamples) : 0.0f;
+        rmsLevels[(size_t)ch] = source >= 0 ? (float)buffer.getRMSLevel(source, 0, numSamples) : 0.0f;
     }
+}
+
+void TeLeQAudioProcessor::pushMeterFrame() noexcept
+{
+    meterFrame.timestamp = juce::Time::getMillisecondCounterHiRes() * 0.001;
+    meterFrames.push(meterFrame);
+}
+
+void TeLeQAudioProcessor::processChain(juce::AudioBuffer<FilterCoefficientType>& buffer, const ChainSettings& chainSettings)
+{
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    // Ao vivo/offline (setNonRealtime) troca de fator só na fronteira do bloco
+    driveOversampling.beginBlock();
+    telefyOversampling.beginBlock();
+
+    // Aplica o Ganho de Entrada
+    const double inputGain = juce::Decibels::decibelsToGain(chainSettings.inputGain);
+    buffer.applyGain(inputGain);
+
+    // Input Meters e analisador (pré)
+    measureLevels(buffer, meterFrame.inputPeak, meterFrame.inputRms);
+    preSpectrum.push(buffer);
 
     // =====================================================================
     // PROCESSAMENTO EM SÉRIE: Input Gain -> Drive -> EQ -> Telefy -> Output
     // =====================================================================
 
-    updateEffectActivationStates();
+    // Os parâmetros de ativação só espelham o estado derivado: a notificação ao
+    // host é feita pelo message thread
+    postActivationStates(chainSettings);
+    TELEQ_PROFILE(profiler.lap(StageProfiler::Input));
 
     // 1. DRIVE
     if (chainSettings.Drive > 0.0)
     {
-        updateDrive(doubleBuffer, chainSettings);
+        updateDrive(buffer, chainSettings);
     }
+    else
+    {
+        // Sem drive o sinal ainda atrasa a latência do oversampling (reportada ao host)
+        driveEngaged = false;
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            driveOversampling.processDelay(ch, buffer.getWritePointer(ch), numSamples, true);
+    }
+
+    TELEQ_PROFILE(profiler.lap(StageProfiler::Drive));
 
     // 2. EQ PRINCIPAL
-    updateFilters();
-    updateFilterActivationStates();
+    // 2+3. EQ E TELEFY: durante automação, os coeficientes são recalculados a cada
+    // sub-bloco de coefficientUpdateInterval amostras a partir dos valores suavizados
+    eqSmoother.setTargets(chainSettings);
+    const int updateInterval = coefficientUpdateInterval.load(std::memory_order_relaxed); // um load por bloco
+    const int subBlockSize = eqSmoother.isSmoothing() ? updateInterval : numSamples;
+
+    for (int start = 0; start < numSamples; start += subBlockSize)
+    {
+        const int length = juce::jmin(subBlockSize, numSamples - start);
 
-    juce::dsp::AudioBlock<FilterCoefficientType> eqBlock(doubleBuffer);
+        auto smoothedSettings = chainSettings;
+        eqSmoother.advance(smoothedSettings, length);
+        updateFilters(smoothedSettings);
 
-    if (eqBlock.getNumChannels() > 0)
-        leftChain.process(juce::dsp::ProcessContextReplacing<FilterCoefficientType>(eqBlock.getSingleChannelBlock(0)));
-    if (eqBlock.getNumChannels() > 1)
-        rightChain.process(juce::dsp::ProcessContextReplacing<FilterCoefficientType>(eqBlock.getSingleChannelBlock(1)));
+        // Buffer que apenas referencia o trecho (sem alocação para <= 32 canais)
+        juce::AudioBuffer<FilterCoefficientType> section(buffer.getArrayOfWritePointers(), numChannels, start, length);
+        processEqAndTelefy(section, smoothedSettings);
+    }
+
+    // =====================================================================
+    // GANHO DE SAÍDA E OUTPUT METERS
+    // =====================================================================
+
+    const double outputGain = juce::Decibels::decibelsToGain(chainSettings.outputGain);
+    buffer.applyGain(outputGain);
+
+    measureLevels(buffer, meterFrame.outputPeak, meterFrame.outputRms);
+    pushMeterFrame();
+    postSpectrum.push(buffer);
+}
+
+void TeLeQAudioProcessor::processEqAndTelefy(juce::AudioBuffer<FilterCoefficientType>& buffer, const ChainSettings& chainSettings)
+{
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
 
-    // 3. TELEFY
-    if (chainSettings.telefyAmount > 0.0)
+    // Troca de engine (A/B): zera o estado para não herdar o de outra topologia
+    const auto engine = eqEngine.load();
+    if (engine != activeEqEngine)
+    {
+        activeEqEngine = engine;
+        resetEqState();
+    }
+
+    const int numStateChannels = juce::jmin(numChannels, numChannelStates);
+
+    if (linearPhaseActive.load(std::memory_order_relaxed))
+    {
+        // Mesma magnitude das cascatas IIR, sem rotação de fase
+        linearPhaseEq.process(buffer);
+    }
+    else if (engine == EqEngine::JuceChain)
+    {
+        juce::dsp::AudioBlock<FilterCoefficientType> eqBlock(buffer);
+
+        for (int ch = 0; ch < numStateChannels; ++ch)
+            channelStates[ch].eqChain.process(juce::dsp::ProcessContextReplacing<FilterCoefficientType>(eqBlock.getSingleChannelBlock((size_t)ch)));
+    }
+    else if (engine == EqEngine::FixedTdf2 && isChannelLinked(numStateChannels))
+    {
+        // Grupos de canais em um registrador SIMD (coeficientes sempre iguais em todos
+        // os canais); um canal que sobra sozinho vai pela cascata escalar
+        auto* const* channels = buffer.getArrayOfWritePointers();
+
+        for (int first = 0, group = 0; first < numStateChannels; first += LinkedEq::numLanes, ++group)
+        {
+            const int groupSize = juce::jmin(LinkedEq::numLanes, numStateChannels - first);
+
+            if (groupSize > 1)
+                linkedEq[(size_t)group].process(channels + first, groupSize, numSamples);
+            else
+                channelStates[first].fixedEq.process(channels[first], numSamples, FilterTopology::Tdf2);
+        }
+    }
+    else
+    {
+        const auto topology = engine == EqEngine::FixedSvf ? FilterTopology::Svf : FilterTopology::Tdf2;
+
+        for (int ch = 0; ch < numStateChannels; ++ch)
+            channelStates[ch].fixedEq.process(buffer.getWritePointer(ch), numSamples, topology);
+    }
+
+    TELEQ_PROFILE(profiler.lap(StageProfiler::Eq));
+
+    // TELEFY
+    const bool telefyEngaged = chainSettings.telefyAmount > 0.0;
+    responseCurve.setEnabled(telefyResponseStage, telefyEngaged);
+
+    // Cópia do buffer para processamento do Telefy (sem realocar), antes do atraso do seco
+    if (telefyEngaged)
+        telefyBuffer.makeCopyOf(buffer, true);
+
+    // O caminho seco sempre atrasa a latência do oversampling do Telefy
+    for (int ch = 0; ch < numChannels; ++ch)
+        telefyOversampling.processDelay(ch, buffer.getWritePointer(ch), numSamples, true);
+
+    if (telefyEngaged)
     {
         double telefySliderValue = chainSettings.telefyAmount;  // 0.0 a 1.0
 
         // Mix sobe de 0% para 100% ao longo de todo o slider
         double telefyMixLevel = juce::jmap(telefySliderValue, 0.0, 1.0, 0.0, 1.0);
 
+        // Parte linear do blend (mesma compensação do laço abaixo) para a curva
+        responseCurve.setMix(telefyResponseStage, telefyMixLevel, 1.0 + telefyMixLevel * 0.5);
+
         // Drive sobe até 50% no meio (0.5) e permanece em 50% até o final
         double telefyDriveLevel = juce::jmin(telefySliderValue * 2.0, 0.5);
         // Explicação: telefySliderValue * 2.0 faz subir 2x mais rápido (0 -> 1.0 em 0.5)
         // juce::jmin(..., 0.5) limita em 0.5 (50%)
 
-        DBG("Telefy Slider: " << telefySliderValue
-            << " | Mix: " << (telefyMixLevel * 100) << "% | Drive: " << (telefyDriveLevel * 100) << "%");
-
-        // Criar cópia do buffer para processamento do Telefy
-        juce::AudioBuffer<FilterCoefficientType> telefyBuffer(numChannels, numSamples);
-        telefyBuffer.makeCopyOf(doubleBuffer);
-
         // Aplicar Saturação Telefy com o nível de drive calculado
-        if (telefyDriveLevel > 0.0)
+        if (telefyDriveLevel > 0.0 && chainSettings.telefyActive)
         {
             // Temporariamente modificar chainSettings para usar o drive correto
             ChainSettings modifiedSettings = chainSettings;
             modifiedSettings.telefyAmount = telefyDriveLevel;
             updateTelefyDrive(telefyBuffer, modifiedSettings);
         }
+        else
+        {
+            // Wet sem saturação: usa o seco já atrasado para continuar alinhado
+            telefyDriveEngaged = false;
+            telefyBuffer.makeCopyOf(buffer, true);
+        }
 
-        // Aplicar Filtro Band-Pass
-        updateTelefyFilter(chainSettings);
+        // Aplicar Filtro Band-Pass (só recalcula se Tone/Intensity mudaram)
+        if (telefyFilterNeedsUpdate)
+        {
+            updateTelefyFilter(chainSettings);
+            telefyFilterNeedsUpdate = false;
+        }
         juce::dsp::AudioBlock<FilterCoefficientType> telefyBlock(telefyBuffer);
 
-        if (telefyBlock.getNumChannels() > 0)
-            leftTelefyChain.process(juce::dsp::ProcessContextReplacing<FilterCoefficientType>(telefyBlock.getSingleChannelBlock(0)));
-        if (telefyBlock.getNumChannels() > 1)
-            rightTelefyChain.process(juce::dsp::ProcessContextReplacing<FilterCoefficientType>(telefyBlock.getSingleChannelBlock(1)));
+        for (int ch = 0; ch < juce::jmin((int)telefyBlock.getNumChannels(), numChannelStates); ++ch)
+            channelStates[ch].telefyChain.process(juce::dsp::ProcessContextReplacing<FilterCoefficientType>(telefyBlock.getSingleChannelBlock((size_t)ch)));
 
         // Fazer o blend final: Telefy wet + Dry (baseado no mix calculado)
         // Com compensação de ganho para manter volume consistente
         for (int ch = 0; ch < numChannels; ++ch)
         {
-            auto* dest = doubleBuffer.getWritePointer(ch);
+            auto* dest = buffer.getWritePointer(ch);
             const double* telefy = telefyBuffer.getReadPointer(ch);
 
             // Ganho de compensação: quanto maior o mix, maior a compensação
@@ -450,37 +666,211 @@ void TeLeQAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::M
             }
         }
     }
+    else
+    {
+        telefyDriveEngaged = false;
+    }
 
-    // =====================================================================
-    // GANHO DE SAÍDA E OUTPUT METERS
-    // =====================================================================
+    TELEQ_PROFILE(profiler.lap(StageProfiler::Telefy));
+}
 
-    const double outputGain = juce::Decibels::decibelsToGain(chainSettings.outputGain);
-    doubleBuffer.applyGain(outputGain);
+bool TeLeQAudioProcessor::isChannelLinked(int numChannels) const
+{
+    return channelLinkEnabled.load(std::memory_order_relaxed) && numChannels > 1 && LinkedEq::isAvailable;
+}
 
-    if (numChannels >= 1)
+void TeLeQAudioProcessor::resetEqState()
+{
+    for (auto& cascade : linkedEq)
+        cascade.reset();
+
+    for (int ch = 0; ch < numChannelStates; ++ch)
     {
-        auto currentOutputPeakL = doubleBuffer.getMagnitude(0, 0, doubleBuffer.getNumSamples());
-        outputPeakL.store((float)juce::jmax((double)outputPeakL.load(), currentOutputPeakL));
+        channelStates[ch].eqChain.reset();
+        channelStates[ch].fixedEq.reset();
     }
-    if (numChannels >= 2)
+}
+
+void TeLeQAudioProcessor::setEqStageCoefficients(int stage, const BiquadDesign::Biquad& coefficients)
+{
+    // Banda em 0 dB é identidade: o estágio é pulado nas cascatas
+    const bool neutral = coefficients.isIdentity();
+    responseCurve.setCoefficients(stage, coefficients);
+
+    for (auto& cascade : linkedEq)
     {
-        auto currentOutputPeakR = doubleBuffer.getMagnitude(1, 0, doubleBuffer.getNumSamples());
-        outputPeakR.store((float)juce::jmax((double)outputPeakR.load(), currentOutputPeakR));
+        cascade.setCoefficients(stage, coefficients);
+        cascade.setElided(stage, neutral);
     }
 
-    // =====================================================================
-    // CONVERSÃO DOUBLE -> FLOAT
-    // =====================================================================
-
-    for (int channel = 0; channel < numChannels; ++channel)
+    for (int ch = 0; ch < numChannelStates; ++ch)
     {
-        auto* srcDouble = doubleBuffer.getReadPointer(channel);
-        auto* destFloat = buffer.getWritePointer(channel);
+        channelStates[ch].fixedEq.setCoefficients(stage, coefficients);
+        channelStates[ch].fixedEq.setElided(stage, neutral);
+    }
+}
 
-        for (int i = 0; i < numSamples; ++i)
-            destFloat[i] = static_cast<float>(srcDouble[i]);
+void TeLeQAudioProcessor::setEqStageBypassed(int stage, bool shouldBeBypassed)
+{
+    responseCurve.setEnabled(stage, !shouldBeBypassed);
+
+    for (auto& cascade : linkedEq)
+        cascade.setBypassed(stage, shouldBeBypassed);
+
+    for (int ch = 0; ch < numChannelStates; ++ch)
+        channelStates[ch].fixedEq.setBypassed(stage, shouldBeBypassed);
+}
+
+void TeLeQAudioProcessor::setConfigurationParameter(const juce::String& parameterID, float value)
+{
+    auto* parameter = apvts.getParameter(parameterID);
+    jassert(parameter != nullptr);
+    parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+}
+
+void TeLeQAudioProcessor::timerCallback()
+{
+    // Sem mudança os reconfigure* retornam sem tocar em nada
+    reconfigureOversampling();
+    reconfigureLinearPhase();
+}
+
+void TeLeQAudioProcessor::setOversampling(int factorLog2, SaturatorOversampling::FilterMode filterMode)
+{
+    setConfigurationParameter("Oversampling", (float)juce::jlimit(0, SaturatorOversampling::maxFactorLog2, factorLog2));
+    setConfigurationParameter("OversamplingFilter", (float)(int)filterMode);
+    reconfigureOversampling();
+}
+
+void TeLeQAudioProcessor::setOfflineOversamplingEnabled(bool shouldUseHigherFactor)
+{
+    setConfigurationParameter("OfflineOversampling", shouldUseHigherFactor ? 1.0f : 0.0f);
+    reconfigureOversampling();
+}
+
+void TeLeQAudioProcessor::setNonRealtime(bool isNonRealtime) noexcept
+{
+    AudioProcessor::setNonRealtime(isNonRealtime);
+
+    // Alguns wrappers chamam isto de dentro do callback: os dois fatores já estão
+    // preparados, então aqui só troca o flag (aplicado no próximo bloco)
+    driveOversampling.setRenderingOffline(isNonRealtime);
+    telefyOversampling.setRenderingOffline(isNonRealtime);
+}
+
+TeLeQAudioProcessor::OversamplingConfig TeLeQAudioProcessor::getOversamplingConfig() const
+{
+    OversamplingConfig config;
+    config.liveFactorLog2 = juce::jlimit(0, SaturatorOversampling::maxFactorLog2, juce::roundToInt(parameters.oversampling->load()));
+    config.offlineFactorLog2 = parameters.offlineOversampling->load() > 0.5f
+        ? SaturatorOversampling::maxFactorLog2 : config.liveFactorLog2;
+    config.filterMode = juce::roundToInt(parameters.oversamplingFilter->load());
+    return config;
+}
+
+void TeLeQAudioProcessor::configureOversampling()
+{
+    const int numChannels = juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels());
+    const auto config = getOversamplingConfig();
+    const auto filterMode = (SaturatorOversampling::FilterMode)config.filterMode;
+
+    driveOversampling.setRenderingOffline(isNonRealtime());
+    telefyOversampling.setRenderingOffline(isNonRealtime());
+    driveOversampling.prepare(numChannels, scratchCapacity, config.liveFactorLog2, config.offlineFactorLog2, filterMode);
+    telefyOversampling.prepare(numChannels, scratchCapacity, config.liveFactorLog2, config.offlineFactorLog2, filterMode);
+    appliedOversampling = config;
+
+    reportLatency();
+}
+
+void TeLeQAudioProcessor::reconfigureOversampling()
+{
+    // Antes do prepareToPlay não há o que reconstruir; sem mudança (ex.: preset com
+    // os mesmos valores) os oversamplers continuam como estão
+    if (scratchCapacity == 0 || getOversamplingConfig() == appliedOversampling)
+        return;
+
+    // Segura o callback enquanto os oversamplers são realocados
+    suspendProcessing(true);
+    configureOversampling();
+    suspendProcessing(false);
+}
+
+void TeLeQAudioProcessor::setLinearPhase(bool shouldBeEnabled, int lengthLog2, LinearPhaseEq::Partitioning partitioning)
+{
+    lengthLog2 = juce::jlimit(LinearPhaseEq::minLengthLog2, LinearPhaseEq::maxLengthLog2, lengthLog2);
+
+    setConfigurationParameter("LinearPhase", shouldBeEnabled ? 1.0f : 0.0f);
+    setConfigurationParameter("LinearPhaseLength", (float)(lengthLog2 - LinearPhaseEq::minLengthLog2));
+    setConfigurationParameter("LinearPhasePartitioning", (float)(int)partitioning);
+    reconfigureLinearPhase();
+}
+
+TeLeQAudioProcessor::LinearPhaseConfig TeLeQAudioProcessor::getLinearPhaseConfig() const
+{
+    LinearPhaseConfig config;
+    config.enabled = parameters.linearPhase->load() > 0.5f;
+    config.lengthLog2 = LinearPhaseEq::minLengthLog2 + juce::roundToInt(parameters.linearPhaseLength->load());
+    config.partitioning = juce::roundToInt(parameters.linearPhasePartitioning->load());
+    return config;
+}
+
+void TeLeQAudioProcessor::configureLinearPhase()
+{
+    const auto config = getLinearPhaseConfig();
+    const bool enabled = config.enabled;
+
+    if (enabled)
+    {
+        const int numChannels = juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels());
+        linearPhaseEq.prepare(numChannels, scratchCapacity, getSampleRate(), config.lengthLog2,
+                              (LinearPhaseEq::Partitioning)config.partitioning);
     }
+    else
+    {
+        linearPhaseEq.release();
+    }
+
+    appliedLinearPhase = config;
+
+    // De volta às cascatas IIR: não herda o estado de antes da fase linear
+    if (linearPhaseActive.load(std::memory_order_relaxed) && !enabled)
+        resetEqState();
+
+    linearPhaseActive.store(enabled, std::memory_order_relaxed);
+    linearPhaseTailSamples.store(enabled ? linearPhaseEq.getKernelLength() / 2 : 0, std::memory_order_relaxed);
+    reportLatency();
+}
+
+void TeLeQAudioProcessor::reconfigureLinearPhase()
+{
+    // Antes do prepareToPlay não há o que reconstruir; sem mudança, os engines e
+    // o kernel atuais continuam valendo
+    if (scratchCapacity == 0 || getLinearPhaseConfig() == appliedLinearPhase)
+        return;
+
+    // Segura o callback enquanto os engines de convolução são realocados
+    suspendProcessing(true);
+    configureLinearPhase();
+    suspendProcessing(false);
+}
+
+void TeLeQAudioProcessor::reportLatency()
+{
+    const int latency = driveOversampling.getLatencyInSamples() + telefyOversampling.getLatencyInSamples()
+                      + linearPhaseEq.getLatencyInSamples();
+
+    // Linha do bypass do host com o mesmo atraso (alocada aqui, fora do callback)
+    bypassDelay.setSize(juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels()), latency);
+    bypassDelay.clear();
+    bypassDelayPosition = 0;
+
+    setLatencySamples(latency);
+}
+
+void TeLeQAudioProcessor::setCoefficientUpdateInterval(int numSamples)
+{
+    coefficientUpdateInterval.store(juce::jlimit(1, 512, numSamples), std::memory_order_relaxed);
 }
 
 //==============================================================================
@@ -513,65 +903,173 @@ void TeLeQAudioProcessor::setStateInformation (const void* data, int sizeInBytes
     if (tree.isValid())
     {
         apvts.replaceState(tree);
-        updateFilters();
+
+        // Os coeficientes serão recalculados pelo audio thread no próximo bloco
+        filtersNeedFullUpdate = true;
+        activationNeedsResync = true;
+
+        // Sem esperar o timer: o preset já toca com a configuração dele. Cada parte
+        // só é reconstruída se a sua configuração mudou
+        reconfigureOversampling();
+        reconfigureLinearPhase();
     }
 
 }
 
-ChainSettings getChainSettings(juce::AudioProcessorValueTreeState& apvts)
+ParameterHandles::ParameterHandles(juce::AudioProcessorValueTreeState& apvts)
 {
+    auto raw = [&apvts](const char* id)
+    {
+        auto* value = apvts.getRawParameterValue(id);
+        jassert(value != nullptr); // ID não existe no layout?
+        return value;
+    };
+
+    auto parameter = [&apvts](const char* id)
+    {
+        auto* p = apvts.getParameter(id);
+        jassert(p != nullptr);
+        return p;
+    };
+
+    // HPF / LPF
+    hpfFreq = raw("HPFFreq");
+    lpfFreq = raw("LPFFreq");
+    hpfSlope = raw("HPF_Slope");
+    lpfSlope = raw("LPF_Slope");
+
+    // Bandas
+    lowFreq = raw("LowFreq");
+    lowGain = raw("LowGain");
+    lowBell = raw("LowBell");
+    lmfFreq = raw("LowMidFreq");
+    lmfGain = raw("LowMidGain");
+    lmfQ = raw("LowMidQ");
+    hmfFreq = raw("HighMidFreq");
+    hmfGain = raw("HighMidGain");
+    hmfQ = raw("HighMidQ");
+    highFreq = raw("HighFreq");
+    highGain = raw("HighGain");
+    highBell = raw("HighBell");
+
+    // Drive / IO
+    driveAmount = raw("DriveAmount");
+    driveType = raw("DriveType");
+    mix = raw("Mix");
+    inputGain = raw("InputGain");
+    outputGain = raw("OutputGain");
+
+    // Telefy
+    telefyFreq = raw("TelefyFreq");
+    telefyQ = raw("TelefyQ");
+    telefySatType = raw("DistortionType");
+    telefyAmount = raw("TelefyAmount");
+    saturationMode = raw("SaturationMode");
+    autoGainMode = raw("AutoGainMode");
+
+    // Ativação
+    hpfActive = parameter("HPFActive");
+    lpfActive = parameter("LPFActive");
+    driveActive = parameter("driveActivate");
+    telefyActive = parameter("telefyActivate");
+
+    // Configuração
+    oversampling = raw("Oversampling");
+    oversamplingFilter = raw("OversamplingFilter");
+    offlineOversampling = raw("OfflineOversampling");
+    linearPhase = raw("LinearPhase");
+    linearPhaseLength = raw("LinearPhaseLength");
+    linearPhasePartitioning = raw("LinearPhasePartitioning");
+}
+
+ChainSettings ParameterHandles::makeSnapshot() const noexcept
+{
+    auto load = [](const std::atomic<float>* value) { return value->load(std::memory_order_relaxed); };
+
     ChainSettings settings;
 
     // HPF / LPF
-    settings.hpfFreq = apvts.getRawParameterValue("HPFFreq")->load();
-    settings.lpfFreq = apvts.getRawParameterValue("LPFFreq")->load();
-    settings.hpfSlope = static_cast<Slope>(apvts.getRawParameterValue("HPF_Slope")->load());
-    settings.lpfSlope = static_cast<Slope>(apvts.getRawParameterValue("LPF_Slope")->load());
-    settings.hpfActive = apvts.getRawParameterValue("HPFActive")->load() > 0.5f;
-    settings.lpfActive = apvts.getRawParameterValue("LPFActive")->load() > 0.5f;
+    settings.hpfFreq = load(hpfFreq);
+    settings.lpfFreq = load(lpfFreq);
+    settings.hpfSlope = static_cast<Slope>(load(hpfSlope));
+    settings.lpfSlope = static_cast<Slope>(load(lpfSlope));
+
+    // Ativação derivada dos knobs: HPF liga acima do mínimo (17 Hz), LPF abaixo
+    // do máximo (22001 Hz). Os parâmetros *Active só espelham isso para o host.
+    settings.hpfActive = settings.hpfFreq > 17.0;
+    settings.lpfActive = settings.lpfFreq < 22001.0;
 
     // Low Band
-    settings.lowFreq = apvts.getRawParameterValue("LowFreq")->load();
-    settings.lowGain = apvts.getRawParameterValue("LowGain")->load();
-	settings.lowBell = apvts.getRawParameterValue("LowBell")->load() > 0.5f;
+    settings.lowFreq = load(lowFreq);
+    settings.lowGain = load(lowGain);
+    settings.lowBell = load(lowBell) > 0.5f;
 
     // Low Mid Band
-    settings.lmfFreq = apvts.getRawParameterValue("LowMidFreq")->load();
-    settings.lmfGain = apvts.getRawParameterValue("LowMidGain")->load();
-    settings.lmfQ = apvts.getRawParameterValue("LowMidQ")->load();
+    settings.lmfFreq = load(lmfFreq);
+    settings.lmfGain = load(lmfGain);
+    settings.lmfQ = load(lmfQ);
 
     // High Mid Band
-    settings.hmfFreq = apvts.getRawParameterValue("HighMidFreq")->load();
-    settings.hmfGain = apvts.getRawParameterValue("HighMidGain")->load();
-    settings.hmfQ = apvts.getRawParameterValue("HighMidQ")->load();
+    settings.hmfFreq = load(hmfFreq);
+    settings.hmfGain = load(hmfGain);
+    settings.hmfQ = load(hmfQ);
 
     // High Band
-    settings.highFreq = apvts.getRawParameterValue("HighFreq")->load();
-    settings.highGain = apvts.getRawParameterValue("HighGain")->load();
-    settings.highBell = apvts.getRawParameterValue("HighBell")->load() > 0.5f;
+    settings.highFreq = load(highFreq);
+    settings.highGain = load(highGain);
+    settings.highBell = load(highBell) > 0.5f;
 
     // Drive
-    settings.Drive = apvts.getRawParameterValue("DriveAmount")->load();
-    settings.driveActive = apvts.getRawParameterValue("driveActivate")->load() > 0.5f;
-    settings.driveType = static_cast<int>(apvts.getRawParameterValue("DriveType")->load());
-	settings.Mix = apvts.getRawParameterValue("Mix")->load(); 
-    settings.inputGain = apvts.getRawParameterValue("InputGain")->load();
-    settings.outputGain = apvts.getRawParameterValue("OutputGain")->load();
+    settings.Drive = load(driveAmount);
+    settings.driveActive = settings.Drive > 0.0;
+    settings.driveType = static_cast<int>(load(driveType));
+    settings.Mix = load(mix);
+    settings.inputGain = load(inputGain);
+    settings.outputGain = load(outputGain);
 
     // Telefy
-    settings.telefyActive = apvts.getRawParameterValue("telefyActivate")->load() > 0.5f;
-	settings.telefyFreq = apvts.getRawParameterValue("TelefyFreq")->load();
-	settings.telefyQ = apvts.getRawParameterValue("TelefyQ")->load(); 
-	settings.telefySatType = static_cast<int>(apvts.getRawParameterValue("DistortionType")->load());
-    settings.telefyAmount = apvts.getRawParameterValue("TelefyAmount")->load();
-
+    settings.telefyFreq = load(telefyFreq);
+    settings.telefyQ = load(telefyQ);
+    settings.telefySatType = static_cast<int>(load(telefySatType));
+    settings.telefyAmount = load(telefyAmount);
+    settings.telefyActive = settings.telefyAmount > 0.0;
+    settings.saturationMode = static_cast<SaturatorKernels::Mode>(static_cast<int>(load(saturationMode)));
+    settings.autoGainMode = static_cast<AutoGain::Mode>(static_cast<int>(load(autoGainMode)));
 
     return settings;
 }
 
-void TeLeQAudioProcessor::updateCoefficients(Coefficients& old, const Coefficients& replacements)
+ChainSettings getChainSettings(juce::AudioProcessorValueTreeState& apvts)
 {
-    *old = *replacements;
+    // Fora do audio thread: resolve os IDs na hora
+    return ParameterHandles(apvts).makeSnapshot();
+}
+
+void TeLeQAudioProcessor::updateCoefficients(Filter& filter, const BiquadDesign::Biquad& replacements)
+{
+    BiquadDesign::assign(*filter.coefficients, replacements);
+}
+
+void TeLeQAudioProcessor::prepareCoefficientStorage()
+{
+    // Cada estágio recebe um storage biquad próprio; depois disso o audio thread
+    // apenas sobrescreve os 5 coeficientes (nenhuma alocação por automação)
+    for (int ch = 0; ch < numChannelStates; ++ch)
+    {
+        auto& chain = channelStates[ch].eqChain;
+
+        chain.get<ChainPositions::HighPass>().get<0>().coefficients = BiquadDesign::makeStorage();
+        chain.get<ChainPositions::HighPass>().get<1>().coefficients = BiquadDesign::makeStorage();
+        chain.get<ChainPositions::LowBand>().coefficients = BiquadDesign::makeStorage();
+        chain.get<ChainPositions::LowMidBand>().coefficients = BiquadDesign::makeStorage();
+        chain.get<ChainPositions::HighMidBand>().coefficients = BiquadDesign::makeStorage();
+        chain.get<ChainPositions::TelefyBandPass>().get<0>().coefficients = BiquadDesign::makeStorage();
+        chain.get<ChainPositions::HighBand>().coefficients = BiquadDesign::makeStorage();
+        chain.get<ChainPositions::LowPass>().get<0>().coefficients = BiquadDesign::makeStorage();
+        chain.get<ChainPositions::LowPass>().get<1>().coefficients = BiquadDesign::makeStorage();
+
+        channelStates[ch].telefyChain.get<0>().coefficients = BiquadDesign::makeStorage();
+    }
 }
 
 void TeLeQAudioProcessor::updateDrive(juce::AudioBuffer<double>& buffer, const ChainSettings& chainSettings)
@@ -582,315 +1080,422 @@ void TeLeQAudioProcessor::updateDrive(juce::AudioBuffer<double>& buffer, const C
     // REMOVIDO: A criação e cópia do 'dryBuffer' não é mais necessária, 
     // pois o blend será feito no processBlock (via dryMixBuffer).
 
+    // Bloco de 0 amostras é entrada válida do host
     if (numChannels == 0 || numSamples == 0)
-    {
-        DBG("Alerta: buffer de audio vazio em updateDrive.");
         return;
-    }
 
     // === DRIVE PROCESSING ===
     driveSmoothed.setTargetValue(chainSettings.Drive * 6.0);
-    const int driveType = chainSettings.driveType;
 
-    for (int channel = 0; channel < numChannels; ++channel)
+    // Troca de modelo: o novo entra com filtros zerados e o antigo sai em crossfade.
+    // Religado depois de um trecho em 0: o mesmo reset, sem crossfade (o kernel
+    // antigo só tem o áudio de quando foi desligado)
+    const bool typeChanged = driveCrossfade.setType(chainSettings.driveType);
+
+    if (typeChanged || !driveEngaged)
+    {
+        resetDriveFilters(chainSettings.driveType);
+        driveOversampling.resetSlot(driveCrossfade.getCurrentSlot());
+    }
+
+    if (!driveEngaged)
+        driveCrossfade.skipFade();
+
+    driveEngaged = true;
+
+    // Rampa de pré-gain calculada uma vez por bloco (igual para todos os canais)
+    auto* driveGains = saturatorScratch.getWritePointer(SaturatorScratch::Gains);
+    for (int sample = 0; sample < numSamples; ++sample)
+        driveGains[sample] = juce::jlimit(0.1, 10.0, driveSmoothed.getNextValue());
+
+    auto* wet = saturatorScratch.getWritePointer(SaturatorScratch::Wet);
+    auto* fadeOut = saturatorScratch.getWritePointer(SaturatorScratch::FadeOut);
+
+    for (int channel = 0; channel < juce::jmin(numChannels, numChannelStates); ++channel)
     {
         // channelData é o buffer WET de entrada/saída (driveBuffer no processBlock)
         auto* channelData = buffer.getWritePointer(channel);
 
-        // Ponteiro para o AutoGain RMS específico deste canal
-        AutoGainRMS* agPtr = nullptr;
-        if (channel < (int)autoGains.size())
+        // Mantém a linha de atraso do bypass em dia (ver processChain)
+        driveOversampling.processDelay(channel, channelData, numSamples, false);
+
+        // --- Aplicação da Saturação (kernel escolhido uma vez por bloco) ---
+        runDriveSaturator(driveCrossfade.getCurrentType(), driveCrossfade.getCurrentSlot(), channel,
+                          chainSettings.saturationMode, channelData, driveGains, wet, numSamples);
+
+        if (driveCrossfade.isFading())
         {
-            agPtr = &autoGains[(size_t)channel];
+            runDriveSaturator(driveCrossfade.getPreviousType(), driveCrossfade.getPreviousSlot(), channel,
+                              chainSettings.saturationMode, channelData, driveGains, fadeOut, numSamples);
+            applySaturatorCrossfade(driveCrossfade, fadeOut, wet, numSamples);
         }
 
-        // Loop principal (melhor unificar o loop para evitar repetição de código)
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            // O valor atual de channelData[sample] é o 'input' (sinal Pós-InputGain)
-            double input = channelData[sample];
-            double satOutput = 0.0; // Variável para o sinal saturado
+        // --- Aplicação do Auto-Gain ---
+        // Auto-gain RMS (processa input original e o output saturado)
+        channelStates[channel].driveAutoGain.process(channelData, wet, channelData, numSamples, chainSettings.autoGainMode);
+    }
 
-            const double driveValue = driveSmoothed.getNextValue();
-            const double driveAmount = juce::jlimit(0.1, 10.0, driveValue);
-            double x = input * driveAmount; // Pré-gain
+    driveCrossfade.advance(numSamples);
 
-            // --- Aplicação da Saturação ---
-            switch (driveType)
-            {
-            case 0: // TAPE
-                satOutput = tapeSaturator(x, tapeFilters[channel]);
-                break;
-            case 1: // TUBE
-                satOutput = tubeSaturator(x, tubeFilters[channel]);
-                break;
-            case 2: // FET
-                satOutput = fetSaturator(x, fetFilters[channel]);
-                break;
-            default:
-                satOutput = x; // Se tipo inválido, passa o pré-gain
-                break;
-            }
+    // REMOVIDO: Toda a seção "// === WET/DRY MIX ==="
+}
 
-            // --- Aplicação do Auto-Gain ---
-            if (agPtr != nullptr)
-            {
-                // Auto-gain RMS (processa input original e o output saturado)
-                satOutput = agPtr->process(input, satOutput);
-            }
-            // else: Se o autoGain falhar (erro na inicialização), satOutput fica com o valor saturado
+void TeLeQAudioProcessor::runDriveSaturator(int type, int slot, int channel, SaturatorKernels::Mode mode,
+                                            const double* input, const double* gains, double* output, int numSamples)
+{
+    // Pré-gain
+    juce::FloatVectorOperations::multiply(output, input, gains, numSamples);
+
+    switch (type)
+    {
+    case 0: // TAPE
+        runDriveModel<SaturatorKernels::Tape>(channelStates[channel].tapeFilters, 3, output, numSamples, mode, driveOversampling, channel, slot);
+        break;
+    case 1: // TUBE
+        runDriveModel<SaturatorKernels::Tube>(channelStates[channel].tubeFilters, 2, output, numSamples, mode, driveOversampling, channel, slot);
+        break;
+    case 2: // FET
+        runDriveModel<SaturatorKernels::Fet>(channelStates[channel].fetFilters, 2, output, numSamples, mode, driveOversampling, channel, slot);
+        break;
+    default: // Se tipo inválido, passa o pré-gain (com a mesma latência)
+        driveOversampling.process(channel, slot, output, numSamples, [](double*, int) {});
+        break;
+    }
+}
 
-            // Sobrescreve o buffer com o sinal 100% WET (Saturado + Auto-Ganho)
-            channelData[sample] = satOutput;
+void TeLeQAudioProcessor::resetDriveFilters(int type)
+{
+    auto resetFilters = [](SaturatorFilters& f)
+    {
+        f.pre1.reset();
+        f.pre2.reset();
+        f.post1.reset();
+        f.post2.reset();
+        f.post3.reset();
+    };
+
+    for (int ch = 0; ch < numChannelStates; ++ch)
+    {
+        auto& state = channelStates[ch];
+
+        switch (type)
+        {
+        case 0: resetFilters(state.tapeFilters); break;
+        case 1: resetFilters(state.tubeFilters); break;
+        case 2: resetFilters(state.fetFilters);  break;
+        default: break;
         }
     }
+}
 
-    // REMOVIDO: Toda a seção "// === WET/DRY MIX ==="
+void TeLeQAudioProcessor::runTelefySaturator(int type, int slot, int channel, SaturatorKernels::Mode mode,
+                                             const double* input, double gain, double* output, int numSamples)
+{
+    // Pré-gain
+    juce::FloatVectorOperations::multiply(output, input, gain, numSamples);
+
+    telefyOversampling.process(channel, slot, output, numSamples, [type, mode](double* upsampled, int numUpsampled)
+    {
+        switch (type)
+        {
+        case 0: // "Distort"
+            SaturatorKernels::apply<SaturatorKernels::FetPlus>(upsampled, numUpsampled, mode);
+            break;
+        case 1: // "Obliterate"
+            SaturatorKernels::apply<SaturatorKernels::Rasp>(upsampled, numUpsampled, mode);
+            break;
+        default:
+            break;
+        }
+    });
+}
+
+namespace
+{
+    // Comparações por estágio: cada estágio do MonoChain só depende dos seus próprios parâmetros
+    bool lowCutChanged(const ChainSettings& a, const ChainSettings& b)
+    {
+        return a.hpfFreq != b.hpfFreq || a.hpfSlope != b.hpfSlope || a.hpfActive != b.hpfActive;
+    }
+
+    bool lowBandChanged(const ChainSettings& a, const ChainSettings& b)
+    {
+        return a.lowFreq != b.lowFreq || a.lowGain != b.lowGain || a.lowBell != b.lowBell;
+    }
+
+    bool lowMidBandChanged(const ChainSettings& a, const ChainSettings& b)
+    {
+        return a.lmfFreq != b.lmfFreq || a.lmfGain != b.lmfGain || a.lmfQ != b.lmfQ;
+    }
+
+    bool highMidBandChanged(const ChainSettings& a, const ChainSettings& b)
+    {
+        return a.hmfFreq != b.hmfFreq || a.hmfGain != b.hmfGain || a.hmfQ != b.hmfQ;
+    }
+
+    bool highBandChanged(const ChainSettings& a, const ChainSettings& b)
+    {
+        return a.highFreq != b.highFreq || a.highGain != b.highGain || a.highBell != b.highBell;
+    }
+
+    bool highCutChanged(const ChainSettings& a, const ChainSettings& b)
+    {
+        return a.lpfFreq != b.lpfFreq || a.lpfSlope != b.lpfSlope || a.lpfActive != b.lpfActive;
+    }
+
+    bool telefyBandChanged(const ChainSettings& a, const ChainSettings& b)
+    {
+        return a.telefyFreq != b.telefyFreq || a.telefyQ != b.telefyQ || a.telefyActive != b.telefyActive;
+    }
 }
 
 void TeLeQAudioProcessor::updateFilters()
 {
-    auto chainSettings = getChainSettings(apvts);
-    updateLowCut(chainSettings);
-    updateLowFilter(chainSettings);
-    updateLowMidFilter(chainSettings);
-    updateHighMidFilter(chainSettings);
-    updateHighFilter(chainSettings);
-    updateHighCut(chainSettings);
+    // Fora do audio thread (prepareToPlay): recalcula tudo
+    filtersNeedFullUpdate = true;
+    updateFilters(parameters.makeSnapshot());
+}
+
+void TeLeQAudioProcessor::updateFilters(const ChainSettings& chainSettings)
+{
+    // Recalcula apenas os estágios cujos parâmetros mudaram desde o último bloco
+    const bool forceAll = filtersNeedFullUpdate.exchange(false);
+    const auto& last = lastFilterSettings;
+
+    if (forceAll || lowCutChanged(last, chainSettings))      updateLowCut(chainSettings);
+    if (forceAll || lowBandChanged(last, chainSettings))     updateLowFilter(chainSettings);
+    if (forceAll || lowMidBandChanged(last, chainSettings))  updateLowMidFilter(chainSettings);
+    if (forceAll || highMidBandChanged(last, chainSettings)) updateHighMidFilter(chainSettings);
+    if (forceAll || highBandChanged(last, chainSettings))    updateHighFilter(chainSettings);
+    if (forceAll || highCutChanged(last, chainSettings))     updateHighCut(chainSettings);
+
+    // O band-pass do Telefy é aplicado no próprio ramo Telefy do processBlock
+    if (forceAll || telefyBandChanged(last, chainSettings))
+        telefyFilterNeedsUpdate = true;
+
+    lastFilterSettings = chainSettings;
 }
 
 
 
 void TeLeQAudioProcessor::updateLowCut(const ChainSettings& chainSettings)
 {
-    auto lowCutCoefficients = juce::dsp::FilterDesign<double>::designIIRHighpassHighOrderButterworthMethod(chainSettings.hpfFreq, getSampleRate(), 2 * (chainSettings.hpfSlope + 1));
-    auto& leftHighPass = leftChain.get<ChainPositions::HighPass>();
-    auto& rightHighPass = rightChain.get<ChainPositions::HighPass>();
-    
-    bool hpfActive = chainSettings.hpfActive;
+    const int order = 2 * (chainSettings.hpfSlope + 1);
+    const bool hpfActive = chainSettings.hpfActive;
+    const double sampleRate = getSampleRate();
+
+    forEachEqChain([](MonoChain& chain)
+    {
+        chain.get<ChainPositions::HighPass>().setBypassed<0>(true);
+        chain.get<ChainPositions::HighPass>().setBypassed<1>(true);
+    });
+    setEqStageBypassed(EqStage::HighPass0, true);
+    setEqStageBypassed(EqStage::HighPass1, true);
 
-    leftHighPass.setBypassed<0>(true);
-    leftHighPass.setBypassed<1>(true);
-    rightHighPass.setBypassed<0>(true);
-    rightHighPass.setBypassed<1>(true);
-    
     switch (chainSettings.hpfSlope)
     {
         case Slope::Slope12:
         {
-            *leftHighPass.get<0>().coefficients = *lowCutCoefficients[0];
-            leftHighPass.setBypassed<0>(!hpfActive);
+            const auto section0 = BiquadDesign::butterworthHighPass(sampleRate, chainSettings.hpfFreq, order, 0);
 
-            *rightHighPass.get<0>().coefficients = *lowCutCoefficients[0];
-            rightHighPass.setBypassed<0>(!hpfActive);
+            forEachEqChain([&](MonoChain& chain)
+            {
+                auto& highPass = chain.get<ChainPositions::HighPass>();
+                updateCoefficients(highPass.get<0>(), section0);
+                highPass.setBypassed<0>(!hpfActive);
+            });
+
+            setEqStageCoefficients(EqStage::HighPass0, section0);
+            setEqStageBypassed(EqStage::HighPass0, !hpfActive);
             break;
         }
         case Slope::Slope24:
         {
-            *leftHighPass.get<0>().coefficients = *lowCutCoefficients[0];
-            leftHighPass.setBypassed<0>(!hpfActive);
-            *leftHighPass.get<1>().coefficients = *lowCutCoefficients[1];
-            leftHighPass.setBypassed<1>(!hpfActive);
-
-            *rightHighPass.get<0>().coefficients = *lowCutCoefficients[0];
-            rightHighPass.setBypassed<0>(!hpfActive);
-            *rightHighPass.get<1>().coefficients = *lowCutCoefficients[1];
-            rightHighPass.setBypassed<1>(!hpfActive);
+            const auto section0 = BiquadDesign::butterworthHighPass(sampleRate, chainSettings.hpfFreq, order, 0);
+            const auto section1 = BiquadDesign::butterworthHighPass(sampleRate, chainSettings.hpfFreq, order, 1);
+
+            forEachEqChain([&](MonoChain& chain)
+            {
+                auto& highPass = chain.get<ChainPositions::HighPass>();
+                updateCoefficients(highPass.get<0>(), section0);
+                highPass.setBypassed<0>(!hpfActive);
+                updateCoefficients(highPass.get<1>(), section1);
+                highPass.setBypassed<1>(!hpfActive);
+            });
+
+            setEqStageCoefficients(EqStage::HighPass0, section0);
+            setEqStageBypassed(EqStage::HighPass0, !hpfActive);
+            setEqStageCoefficients(EqStage::HighPass1, section1);
+            setEqStageBypassed(EqStage::HighPass1, !hpfActive);
             break;
         }
     }
-    
 }
 
 void TeLeQAudioProcessor::updateLowFilter(const ChainSettings& chainSettings)
 {
+    const auto gain = juce::Decibels::decibelsToGain(chainSettings.lowGain);
+
     if (chainSettings.lowBell)
     {
         FilterCoefficientType fixedLowQ{ 1.2 };
-        auto LowPeakCoefficients = juce::dsp::IIR::Coefficients<FilterCoefficientType>::makePeakFilter(
-            getSampleRate(),
-            chainSettings.lowFreq,
-            fixedLowQ,
-            juce::Decibels::decibelsToGain(chainSettings.lowGain));
+        const auto lowPeakCoefficients = BiquadDesign::peak(getSampleRate(), chainSettings.lowFreq, fixedLowQ, gain);
 
-        *leftChain.get<ChainPositions::LowBand>().coefficients = *LowPeakCoefficients;
-        *rightChain.get<ChainPositions::LowBand>().coefficients = *LowPeakCoefficients;
+        forEachEqChain([&](MonoChain& chain) { updateCoefficients(chain.get<ChainPositions::LowBand>(), lowPeakCoefficients); });
+        setEqStageCoefficients(EqStage::LowBand, lowPeakCoefficients);
     }
     else
     {
-        auto LowCoefficients = juce::dsp::IIR::Coefficients<FilterCoefficientType>::makeLowShelf(
-            getSampleRate(),
-            chainSettings.lowFreq,
-            0.5f, // Q fixo para shelf  
-            juce::Decibels::decibelsToGain(chainSettings.lowGain));
+        // Q fixo para shelf
+        const auto lowCoefficients = BiquadDesign::lowShelf(getSampleRate(), chainSettings.lowFreq, 0.5, gain);
 
-        *leftChain.get<ChainPositions::LowBand>().coefficients = *LowCoefficients;
-        *rightChain.get<ChainPositions::LowBand>().coefficients = *LowCoefficients;
+        forEachEqChain([&](MonoChain& chain) { updateCoefficients(chain.get<ChainPositions::LowBand>(), lowCoefficients); });
+        setEqStageCoefficients(EqStage::LowBand, lowCoefficients);
     }
 }
 
 
 void TeLeQAudioProcessor::updateLowMidFilter(const ChainSettings& chainSettings)
 {
-    auto LowMidCoefficients = juce::dsp::IIR::Coefficients<FilterCoefficientType>::makePeakFilter(
+    const auto lowMidCoefficients = BiquadDesign::peak(
         getSampleRate(),
         chainSettings.lmfFreq,
         chainSettings.lmfQ,
         juce::Decibels::decibelsToGain(chainSettings.lmfGain));
 
-    *leftChain.get<ChainPositions::LowMidBand>().coefficients = *LowMidCoefficients;
-    *rightChain.get<ChainPositions::LowMidBand>().coefficients = *LowMidCoefficients;
+    forEachEqChain([&](MonoChain& chain) { updateCoefficients(chain.get<ChainPositions::LowMidBand>(), lowMidCoefficients); });
+    setEqStageCoefficients(EqStage::LowMidBand, lowMidCoefficients);
 }
 
 void TeLeQAudioProcessor::updateHighMidFilter(const ChainSettings& chainSettings)
 {
-    auto HighMidCoefficients = juce::dsp::IIR::Coefficients<FilterCoefficientType>::makePeakFilter(
+    const auto highMidCoefficients = BiquadDesign::peak(
         getSampleRate(),
         chainSettings.hmfFreq,
         chainSettings.hmfQ,
         juce::Decibels::decibelsToGain(chainSettings.hmfGain));
 
-
-
-    *leftChain.get<ChainPositions::HighMidBand>().coefficients = *HighMidCoefficients;
-    *rightChain.get<ChainPositions::HighMidBand>().coefficients = *HighMidCoefficients;
+    forEachEqChain([&](MonoChain& chain) { updateCoefficients(chain.get<ChainPositions::HighMidBand>(), highMidCoefficients); });
+    setEqStageCoefficients(EqStage::HighMidBand, highMidCoefficients);
 }
 
 void TeLeQAudioProcessor::updateHighFilter(const ChainSettings& chainSettings)
 {
+    const auto gain = juce::Decibels::decibelsToGain(chainSettings.highGain);
+
     if (chainSettings.highBell)
     {
         FilterCoefficientType fixedHighQ{ 1.0 };
-        auto HighPeakCoefficients = juce::dsp::IIR::Coefficients<FilterCoefficientType>::makePeakFilter(
-            getSampleRate(),
-            chainSettings.highFreq,
-            fixedHighQ,
-            juce::Decibels::decibelsToGain(chainSettings.highGain));
+        const auto highPeakCoefficients = BiquadDesign::peak(getSampleRate(), chainSettings.highFreq, fixedHighQ, gain);
 
-        *leftChain.get<ChainPositions::HighBand>().coefficients = *HighPeakCoefficients;
-        *rightChain.get<ChainPositions::HighBand>().coefficients = *HighPeakCoefficients;
+        forEachEqChain([&](MonoChain& chain) { updateCoefficients(chain.get<ChainPositions::HighBand>(), highPeakCoefficients); });
+        setEqStageCoefficients(EqStage::HighBand, highPeakCoefficients);
     }
     else
     {
-        auto HighCoefficients = juce::dsp::IIR::Coefficients<FilterCoefficientType>::makeHighShelf(
-            getSampleRate(),
-            chainSettings.highFreq,
-            0.5f, // Q fixo para shelf  
-            juce::Decibels::decibelsToGain(chainSettings.highGain));
+        // Q fixo para shelf
+        const auto highCoefficients = BiquadDesign::highShelf(getSampleRate(), chainSettings.highFreq, 0.5, gain);
 
-        *leftChain.get<ChainPositions::HighBand>().coefficients = *HighCoefficients;
-        *rightChain.get<ChainPositions::HighBand>().coefficients = *HighCoefficients;
+        forEachEqChain([&](MonoChain& chain) { updateCoefficients(chain.get<ChainPositions::HighBand>(), highCoefficients); });
+        setEqStageCoefficients(EqStage::HighBand, highCoefficients);
     }
 }
 
 void TeLeQAudioProcessor::updateHighCut(const ChainSettings& chainSettings)
 {
-    auto highCutCoefficients = juce::dsp::FilterDesign<double>::designIIRLowpassHighOrderButterworthMethod(chainSettings.lpfFreq, getSampleRate(), 2 * (chainSettings.lpfSlope + 1));
-    auto& leftLowPass = leftChain.get<ChainPositions::LowPass>();
-    auto& rightLowPass = rightChain.get<ChainPositions::LowPass>();
+    const int order = 2 * (chainSettings.lpfSlope + 1);
+    const bool lpfActive = chainSettings.lpfActive;
+    const double sampleRate = getSampleRate();
 
-    bool lpfActive = chainSettings.lpfActive;
-
-    leftLowPass.setBypassed<0>(true);
-    leftLowPass.setBypassed<1>(true);
-    rightLowPass.setBypassed<0>(true);
-    rightLowPass.setBypassed<1>(true);
+    forEachEqChain([](MonoChain& chain)
+    {
+        chain.get<ChainPositions::LowPass>().setBypassed<0>(true);
+        chain.get<ChainPositions::LowPass>().setBypassed<1>(true);
+    });
+    setEqStageBypassed(EqStage::LowPass0, true);
+    setEqStageBypassed(EqStage::LowPass1, true);
 
     switch (chainSettings.lpfSlope)
     {
         case Slope::Slope12:
         {
-            *leftLowPass.get<0>().coefficients = *highCutCoefficients[0];
-            leftLowPass.setBypassed<0>(!lpfActive);
+            const auto section0 = BiquadDesign::butterworthLowPass(sampleRate, chainSettings.lpfFreq, order, 0);
+
+            forEachEqChain([&](MonoChain& chain)
+            {
+                auto& lowPass = chain.get<ChainPositions::LowPass>();
+                updateCoefficients(lowPass.get<0>(), section0);
+                lowPass.setBypassed<0>(!lpfActive);
+            });
 
-            *rightLowPass.get<0>().coefficients = *highCutCoefficients[0];
-            rightLowPass.setBypassed<0>(!lpfActive);
+            setEqStageCoefficients(EqStage::LowPass0, section0);
+            setEqStageBypassed(EqStage::LowPass0, !lpfActive);
             break;
         }
         case Slope::Slope24:
         {
-            *leftLowPass.get<0>().coefficients = *highCutCoefficients[0];
-            leftLowPass.setBypassed<0>(!lpfActive);
-            *leftLowPass.get<1>().coefficients = *highCutCoefficients[1];
-            leftLowPass.setBypassed<1>(!lpfActive);
-
-            *rightLowPass.get<0>().coefficients = *highCutCoefficients[0];
-            rightLowPass.setBypassed<0>(!lpfActive);
-            *rightLowPass.get<1>().coefficients = *highCutCoefficients[1];
-            rightLowPass.setBypassed<1>(!lpfActive);
+            const auto section0 = BiquadDesign::butterworthLowPass(sampleRate, chainSettings.lpfFreq, order, 0);
+            const auto section1 = BiquadDesign::butterworthLowPass(sampleRate, chainSettings.lpfFreq, order, 1);
+
+            forEachEqChain([&](MonoChain& chain)
+            {
+                auto& lowPass = chain.get<ChainPositions::LowPass>();
+                updateCoefficients(lowPass.get<0>(), section0);
+                lowPass.setBypassed<0>(!lpfActive);
+                updateCoefficients(lowPass.get<1>(), section1);
+                lowPass.setBypassed<1>(!lpfActive);
+            });
+
+            setEqStageCoefficients(EqStage::LowPass0, section0);
+            setEqStageBypassed(EqStage::LowPass0, !lpfActive);
+            setEqStageCoefficients(EqStage::LowPass1, section1);
+            setEqStageBypassed(EqStage::LowPass1, !lpfActive);
             break;
         }
     }
 }
 
-void TeLeQAudioProcessor::updateFilterActivationStates()
-{
-    // Obter valores atuais dos knobs
-    float hpfFreqValue = *apvts.getRawParameterValue("HPFFreq");
-    float lpfFreqValue = *apvts.getRawParameterValue("LPFFreq");
-
-    // Obter os parâmetros de ativação
-    auto* hpfActiveParam = apvts.getParameter("HPFActive");
-    auto* lpfActiveParam = apvts.getParameter("LPFActive");
-
-    // HPF: Ativar quando frequência > 18 Hz (valor mínimo)
-    // Range: 18.f a 450.f
-    bool hpfShouldBeOn = hpfFreqValue > 17.0f;
-    if ((hpfActiveParam->getValue() >= 0.5f) != hpfShouldBeOn)
-    {
-        hpfActiveParam->setValueNotifyingHost(hpfShouldBeOn ? 1.0f : 0.0f);
-    }
-
-    // LPF: Ativar quando frequência < 22001 Hz (valor máximo)
-    // Range: 2000.f a 22000.f
-    bool lpfShouldBeOn = lpfFreqValue < 22001.0f;
-    if ((lpfActiveParam->getValue() >= 0.5f) != lpfShouldBeOn)
-    {
-        lpfActiveParam->setValueNotifyingHost(lpfShouldBeOn ? 1.0f : 0.0f);
-    }
-}
-
-void TeLeQAudioProcessor::updateEffectActivationStates()
+void TeLeQAudioProcessor::postActivationStates(const ChainSettings& chainSettings)
 {
-	float driveAmount = *apvts.getRawParameterValue("DriveAmount");
-	float telefyAmount = *apvts.getRawParameterValue("TelefyAmount");
+    // Depois de um setStateInformation, reposta tudo para ressincronizar o host
+    if (activationNeedsResync.exchange(false))
+        postedActivation.fill(-1);
 
-	auto* driveActiveParam = apvts.getParameter("driveActivate");
-	auto* telefyActiveParam = apvts.getParameter("telefyActivate");
+    const std::array<bool, numActivationParameters> states{
+        chainSettings.hpfActive, chainSettings.lpfActive,
+        chainSettings.driveActive, chainSettings.telefyActive };
 
-	bool driveShouldBeOn = driveAmount > 0.0f;
-    if ((driveActiveParam->getValue() >= 0.5f) != driveShouldBeOn)
+    for (size_t i = 0; i < states.size(); ++i)
     {
-        driveActiveParam->setValueNotifyingHost(driveShouldBeOn ? 1.0f : 0.0f);
-	}
+        const int state = states[i] ? 1 : 0;
 
-    bool telefyShouldBeOn = telefyAmount > 0.0f;
-    if ((telefyActiveParam->getValue() >= 0.5f) != telefyShouldBeOn)
-    {
-        telefyActiveParam->setValueNotifyingHost(telefyShouldBeOn ? 1.0f : 0.0f);
+        // Só posta mudanças; se a fila estiver cheia, tenta de novo no próximo bloco
+        if (state != postedActivation[i]
+            && activationNotifications.post(activationParameters[i], (float)state))
+            postedActivation[i] = state;
     }
-
-
-
 }
 
-
-
 void TeLeQAudioProcessor::updateTelefyFilter(const ChainSettings& chainSettings)
 {
-    auto TelefyCoefficients = juce::dsp::IIR::Coefficients<FilterCoefficientType>::makeBandPass(
+    const auto telefyCoefficients = BiquadDesign::bandPass(
         getSampleRate(),
         chainSettings.telefyFreq,
         chainSettings.telefyQ);
 
     // Configura os coeficientes na nova cadeia Telefy
-    *leftTelefyChain.get<0>().coefficients = *TelefyCoefficients;
-    *rightTelefyChain.get<0>().coefficients = *TelefyCoefficients;
-
     // O bypass (ativação) agora é feito na TelefyChain
     // Nota: O TelefyChain tem apenas um elemento, então o índice é 0 (get<0>).
-    leftTelefyChain.setBypassed<0>(!chainSettings.telefyActive);
-    rightTelefyChain.setBypassed<0>(!chainSettings.telefyActive);
+    // Band-pass desligado: o ramo wet é o sinal saturado sem filtro
+    responseCurve.setCoefficients(telefyResponseStage, chainSettings.telefyActive ? telefyCoefficients
+                                                                                 : BiquadDesign::identity());
+
+    for (int ch = 0; ch < numChannelStates; ++ch)
+    {
+        auto& telefyChain = channelStates[ch].telefyChain;
+        updateCoefficients(telefyChain.get<0>(), telefyCoefficients);
+        telefyChain.setBypassed<0>(!chainSettings.telefyActive);
+    }
 }
 
 void TeLeQAudioProcessor::updateTelefyDrive(juce::AudioBuffer<double>& buffer,
@@ -909,34 +1514,46 @@ void TeLeQAudioProcessor::updateTelefyDrive(juce::AudioBuffer<double>& buffer,
     // Drive sobe linearmente
     const double drive = amount;
 
-    const int satType = chainSettings.telefySatType;
+    // Pré-gain proporcional ao drive (constante no bloco)
+    const double preGain = 1.0 + drive * 5.0;
 
-    // === PROCESSAMENTO POR CANAL ===
-    for (int ch = 0; ch < numChannels; ++ch)
-    {
-        auto* samples = buffer.getWritePointer(ch);
-        AutoGainRMS& ag = telefyAutoGain[ch];
+    // Mesmo reset do updateDrive na troca de modelo e na volta de um trecho desligado
+    const bool typeChanged = telefyCrossfade.setType(chainSettings.telefySatType);
 
+    if (typeChanged || !telefyDriveEngaged)
+        telefyOversampling.resetSlot(telefyCrossfade.getCurrentSlot());
 
-        for (int i = 0; i < numSamples; ++i)
-        {
-            // 1. Sinal Seco (antes do drive/saturação)
-            const double dry = samples[i];
+    if (!telefyDriveEngaged)
+        telefyCrossfade.skipFade();
 
-            // 2. Pré-gain proporcional ao drive
-            double x = dry * (1.0 + drive * 5.0);
+    telefyDriveEngaged = true;
 
-            // 3. Saturador dedicado do Telefy
-            double sat = TelefySat::telefySaturator(x, satType);
+    auto* wet = saturatorScratch.getWritePointer(SaturatorScratch::Wet);
+    auto* fadeOut = saturatorScratch.getWritePointer(SaturatorScratch::FadeOut);
 
-            // 4. Auto-Gain RMS → normaliza entre o original (dry) e o saturado (sat)
-            sat = ag.process(dry, sat);
+    // === PROCESSAMENTO POR CANAL ===
+    for (int ch = 0; ch < juce::jmin(numChannels, numChannelStates); ++ch)
+    {
+        auto* samples = buffer.getWritePointer(ch);
+        AutoGain& ag = channelStates[ch].telefyAutoGain;
 
-            // 5. SOBRESCREVE o buffer com o sinal SATURADO (Wet)
-            samples[i] = sat;
+        // Saturador dedicado do Telefy (sem estado: o laço vetoriza por modelo)
+        runTelefySaturator(telefyCrossfade.getCurrentType(), telefyCrossfade.getCurrentSlot(), ch,
+                           chainSettings.saturationMode, samples, preGain, wet, numSamples);
 
+        if (telefyCrossfade.isFading())
+        {
+            runTelefySaturator(telefyCrossfade.getPreviousType(), telefyCrossfade.getPreviousSlot(), ch,
+                               chainSettings.saturationMode, samples, preGain, fadeOut, numSamples);
+            applySaturatorCrossfade(telefyCrossfade, fadeOut, wet, numSamples);
         }
+
+        // Auto-Gain RMS → normaliza entre o original (dry) e o saturado, e
+        // SOBRESCREVE o buffer com o sinal SATURADO (Wet)
+        ag.process(samples, wet, samples, numSamples, chainSettings.autoGainMode);
     }
+
+    telefyCrossfade.advance(numSamples);
 }
 
 juce::AudioProcessorValueTreeState::ParameterLayout 
@@ -1011,6 +1628,34 @@ juce::AudioProcessorValueTreeState::ParameterLayout
     layout.add(std::make_unique<juce::AudioParameterFloat>("InputGain", "Input Gain", juce::NormalisableRange<float>(-24.f, 12.f, 0.5f, 1.f), 0.0f));
 	layout.add(std::make_unique<juce::AudioParameterFloat>("OutputGain", "Output Gain", juce::NormalisableRange<float>(-24.f, 12.f, 0.5f, 1.f), 0.0f));
 
+    // Mesma ordem de SaturatorKernels::Mode (Exact é o padrão; Fast é opt-in)
+    juce::StringArray saturationModes{ "Exact", "Fast" };
+    layout.add(std::make_unique<juce::AudioParameterChoice>("SaturationMode", "Saturation Mode", saturationModes, 0));
+
+    // Mesma ordem de AutoGain::Mode
+    juce::StringArray autoGainModes{ "RMS", "K-Weighted" };
+    layout.add(std::make_unique<juce::AudioParameterChoice>("AutoGainMode", "Auto-Gain Mode", autoGainModes, 0));
+
+    // Configuração: cada mudança reconstrói os estágios e muda a latência reportada
+    // (aplicada pelo message thread, ver timerCallback)
+    juce::StringArray oversamplingFactors{ "1x", "2x", "4x", "8x" };         // índice = factorLog2
+    juce::StringArray oversamplingFilters{ "IIR (Low Latency)", "FIR (Linear Phase)" };
+
+    layout.add(std::make_unique<juce::AudioParameterChoice>("Oversampling", "Oversampling", oversamplingFactors, 0));
+    layout.add(std::make_unique<juce::AudioParameterChoice>("OversamplingFilter", "Oversampling Filter", oversamplingFilters, 0));
+    layout.add(std::make_unique<juce::AudioParameterBool>("OfflineOversampling", "Offline 8x", false));
+
+    // Índice = lengthLog2 - LinearPhaseEq::minLengthLog2; a ordem segue LinearPhaseEq::Partitioning
+    juce::StringArray linearPhaseLengths{ "4096", "8192", "16384", "32768" };
+    juce::StringArray linearPhasePartitionings{ "Uniform", "Non-Uniform" };
+    static_assert(LinearPhaseEq::maxLengthLog2 - LinearPhaseEq::minLengthLog2 == 3, "linearPhaseLengths desatualizado");
+
+    layout.add(std::make_unique<juce::AudioParameterBool>("LinearPhase", "Linear Phase", false));
+    layout.add(std::make_unique<juce::AudioParameterChoice>("LinearPhaseLength", "Linear Phase Length", linearPhaseLengths,
+                                                            LinearPhaseEq::defaultLengthLog2 - LinearPhaseEq::minLengthLog2));
+    layout.add(std::make_unique<juce::AudioParameterChoice>("LinearPhasePartitioning", "Linear Phase Partitioning", linearPhasePartitionings,
+                                                            (int)LinearPhaseEq::Partitioning::NonUniform));
+
 
 
     return layout;
@@ -12,6 +12,19 @@
 #include <juce_dsp/juce_dsp.h>
 #include <juce_audio_processors/juce_audio_processors.h>
 #include "BarMeterComponent.h"
+#include "RealtimeGuard.h"
+#include "BiquadDesign.h"
+#include "LinkedBiquadCascade.h"
+#include "FixedBiquadCascade.h"
+#include "SaturatorKernels.h"
+#include "SaturatorOversampling.h"
+#include "ParameterNotificationQueue.h"
+#include "AutoGain.h"
+#include "StageProfiler.h"
+#include "MeterFrameQueue.h"
+#include "SpectrumAnalyzer.h"
+#include "ResponseCurve.h"
+#include "LinearPhaseEq.h"
 
 using FilterCoefficientType = double;
 
@@ -54,6 +67,8 @@ struct ChainSettings
 //	float driveAmount{ 0 };					   // quantidade de drive
     int driveType{ 0 };                       // tipo opcional
     int telefySatType{ 0};
+    SaturatorKernels::Mode saturationMode{ SaturatorKernels::Mode::Exact };
+    AutoGain::Mode autoGainMode{ AutoGain::Mode::Rms };
 
     // INPUT / OUTPUT
     double inputGain{ 0 };     // ganho de entrada em dB
@@ -62,33 +77,184 @@ struct ChainSettings
 
 ChainSettings getChainSettings(juce::AudioProcessorValueTreeState& apvts);
 
-struct AutoGainRMS
+// Tabela tipada dos parâmetros: os ponteiros do APVTS são resolvidos uma vez
+// (construtor do processor) e o snapshot por bloco vira só loads atômicos
+struct ParameterHandles
 {
-    double rmsIn = 1e-12;
-    double rmsOut = 1e-12;
-    double gain = 1.0;
+    explicit ParameterHandles(juce::AudioProcessorValueTreeState& apvts);
+
+    ChainSettings makeSnapshot() const noexcept;
+
+    std::atomic<float>* hpfFreq = nullptr;
+    std::atomic<float>* lpfFreq = nullptr;
+    std::atomic<float>* hpfSlope = nullptr;
+    std::atomic<float>* lpfSlope = nullptr;
+
+    std::atomic<float>* lowFreq = nullptr;
+    std::atomic<float>* lowGain = nullptr;
+    std::atomic<float>* lowBell = nullptr;
+    std::atomic<float>* lmfFreq = nullptr;
+    std::atomic<float>* lmfGain = nullptr;
+    std::atomic<float>* lmfQ = nullptr;
+    std::atomic<float>* hmfFreq = nullptr;
+    std::atomic<float>* hmfGain = nullptr;
+    std::atomic<float>* hmfQ = nullptr;
+    std::atomic<float>* highFreq = nullptr;
+    std::atomic<float>* highGain = nullptr;
+    std::atomic<float>* highBell = nullptr;
+
+    std::atomic<float>* driveAmount = nullptr;
+    std::atomic<float>* driveType = nullptr;
+    std::atomic<float>* mix = nullptr;
+    std::atomic<float>* inputGain = nullptr;
+    std::atomic<float>* outputGain = nullptr;
+
+    std::atomic<float>* telefyFreq = nullptr;
+    std::atomic<float>* telefyQ = nullptr;
+    std::atomic<float>* telefySatType = nullptr;
+    std::atomic<float>* telefyAmount = nullptr;
+    std::atomic<float>* saturationMode = nullptr;
+    std::atomic<float>* autoGainMode = nullptr;
+
+    // Ativação (só espelham o estado derivado, ver postActivationStates)
+    juce::RangedAudioParameter* hpfActive = nullptr;
+    juce::RangedAudioParameter* lpfActive = nullptr;
+    juce::RangedAudioParameter* driveActive = nullptr;
+    juce::RangedAudioParameter* telefyActive = nullptr;
+
+    // Configuração: lida pelo message thread (ver TeLeQAudioProcessor::timerCallback),
+    // nunca no snapshot do bloco, porque cada mudança reconstrói e muda a latência
+    std::atomic<float>* oversampling = nullptr;
+    std::atomic<float>* oversamplingFilter = nullptr;
+    std::atomic<float>* offlineOversampling = nullptr;
+    std::atomic<float>* linearPhase = nullptr;
+    std::atomic<float>* linearPhaseLength = nullptr;
+    std::atomic<float>* linearPhasePartitioning = nullptr;
+};
+
+// Crossfade linear entre o kernel de saturação antigo e o novo quando o tipo
+// muda durante o playback (evita o clique da troca instantânea)
+struct SaturatorCrossfade
+{
+    void reset(int type, int lengthInSamples)
+    {
+        currentType = previousType = type;
+        currentSlot = 0;
+        fadeLength = juce::jmax(1, lengthInSamples);
+        fadeRemaining = 0;
+    }
+
+    // true se o tipo mudou e um novo crossfade começou
+    bool setType(int newType)
+    {
+        if (newType == currentType)
+            return false;
+
+        previousType = currentType;
+        currentType = newType;
+        currentSlot ^= 1;
+        fadeRemaining = fadeLength;
+        return true;
+    }
+
+    bool isFading() const noexcept { return fadeRemaining > 0; }
+    int getCurrentType() const noexcept { return currentType; }
+    int getPreviousType() const noexcept { return previousType; }
+
+    // Slot de estado (oversampling) de cada kernel: o novo usa o slot livre
+    int getCurrentSlot() const noexcept { return currentSlot; }
+    int getPreviousSlot() const noexcept { return currentSlot ^ 1; }
+
+    // Peso do kernel novo na amostra i do bloco atual
+    double getNewGain(int i) const noexcept
+    {
+        return 1.0 - (double)juce::jmax(0, fadeRemaining - i) / (double)fadeLength;
+    }
+
+    void advance(int numSamples) noexcept { fadeRemaining = juce::jmax(0, fadeRemaining - numSamples); }
+
+    // Encerra o crossfade em andamento: o kernel antigo não toca mais
+    void skipFade() noexcept { fadeRemaining = 0; }
+
+private:
+    int currentType = 0, previousType = 0;
+    int currentSlot = 0;
+    int fadeLength = 1, fadeRemaining = 0;
+};
+
+// Suavização dos parâmetros contínuos do EQ/Telefy (frequência em escala log,
+// ganho e Q lineares). Os campos discretos (slope, bell, active) não rampam.
+struct EqParameterSmoother
+{
+    using Field = FilterCoefficientType ChainSettings::*;
+    using LogSmoother = juce::SmoothedValue<double, juce::ValueSmoothingTypes::Multiplicative>;
+    using LinearSmoother = juce::SmoothedValue<double, juce::ValueSmoothingTypes::Linear>;
+
+    static constexpr std::array<Field, 7> frequencyFields{
+        &ChainSettings::hpfFreq, &ChainSettings::lpfFreq, &ChainSettings::lowFreq,
+        &ChainSettings::lmfFreq, &ChainSettings::hmfFreq, &ChainSettings::highFreq,
+        &ChainSettings::telefyFreq };
 
-    // smoothing tempo; ajuste conforme queira (0.003 - 0.01)
-    double smoothing = 0.005;
+    static constexpr std::array<Field, 7> linearFields{
+        &ChainSettings::lowGain, &ChainSettings::lmfGain, &ChainSettings::hmfGain,
+        &ChainSettings::highGain, &ChainSettings::lmfQ, &ChainSettings::hmfQ,
+        &ChainSettings::telefyQ };
 
-    inline double process(double input, double output)
+    std::array<LogSmoother, frequencyFields.size()> frequencies;
+    std::array<LinearSmoother, linearFields.size()> linears;
+
+    void reset(double sampleRate, double rampSeconds, const ChainSettings& settings)
+    {
+        for (size_t i = 0; i < frequencyFields.size(); ++i)
+        {
+            frequencies[i].reset(sampleRate, rampSeconds);
+            frequencies[i].setCurrentAndTargetValue(settings.*frequencyFields[i]);
+        }
+
+        for (size_t i = 0; i < linearFields.size(); ++i)
+        {
+            linears[i].reset(sampleRate, rampSeconds);
+            linears[i].setCurrentAndTargetValue(settings.*linearFields[i]);
+        }
+    }
+
+    void setTargets(const ChainSettings& settings)
     {
-        // atualiza RMS (exponencial simples)
-        rmsIn = (1.0 - smoothing) * rmsIn + smoothing * (input * input);
-        rmsOut = (1.0 - smoothing) * rmsOut + smoothing * (output * output);
+        for (size_t i = 0; i < frequencyFields.size(); ++i)
+            frequencies[i].setTargetValue(settings.*frequencyFields[i]);
+
+        for (size_t i = 0; i < linearFields.size(); ++i)
+            linears[i].setTargetValue(settings.*linearFields[i]);
+    }
 
-        double target = (rmsOut > 1e-12 ? std::sqrt(rmsIn / rmsOut) : 1.0);
+    // Avança numSamples e escreve os valores suavizados em settings
+    void advance(ChainSettings& settings, int numSamples)
+    {
+        for (size_t i = 0; i < frequencyFields.size(); ++i)
+            settings.*frequencyFields[i] = frequencies[i].skip(numSamples);
+
+        for (size_t i = 0; i < linearFields.size(); ++i)
+            settings.*linearFields[i] = linears[i].skip(numSamples);
+    }
+
+    bool isSmoothing() const
+    {
+        for (auto& smoother : frequencies)
+            if (smoother.isSmoothing())
+                return true;
 
-        // suaviza a transicao do ganho
-        gain = (1.0 - smoothing) * gain + smoothing * target;
+        for (auto& smoother : linears)
+            if (smoother.isSmoothing())
+                return true;
 
-        return output * gain;
+        return false;
     }
 };
 
 //==============================================================================
 
-class TeLeQAudioProcessor : public juce::AudioProcessor
+class TeLeQAudioProcessor : public juce::AudioProcessor,
+                            private juce::Timer
 {
 public:
     //==============================================================================
@@ -104,6 +270,12 @@ public:
 #endif
 
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override { return true; }
+
+    // Bypass do host: atrasa a latência reportada (oversampling + fase linear)
+    void processBlockBypassed(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlockBypassed(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -131,41 +303,183 @@ public:
     void updateDrive(juce::AudioBuffer<double>& buffer, const ChainSettings& chainSettings);
 	void updateTelefyDrive(juce::AudioBuffer<double>& buffer, const ChainSettings& chainSettings);
 
-    std::atomic<float> inputPeakL{ 0.0f };
-    std::atomic<float> inputPeakR{ 0.0f };
-    std::atomic<float> outputPeakL{ 0.0f };
-    std::atomic<float> outputPeakR{ 0.0f };
+    // Processa os canais em grupos via SIMD, um canal por lane (desligado = cascata por canal)
+    void setChannelLinkEnabled(bool shouldBeEnabled) { channelLinkEnabled.store(shouldBeEnabled, std::memory_order_relaxed); }
+
+    // Qualquer layout com entrada == saída até este número de canais (mono .. 7.1.4 e além)
+    static constexpr int maxNumChannels = 32;
+
+    // Implementação do EQ principal, para A/B e null test entre as topologias
+    enum class EqEngine
+    {
+        JuceChain,  // MonoChain original (juce::dsp::IIR::Filter)
+        FixedTdf2,  // FixedBiquadCascade / LinkedBiquadCascade em TDF-II
+        FixedSvf    // FixedBiquadCascade em SVF trapezoidal
+    };
+
+    void setEqEngine(EqEngine newEngine) { eqEngine = newEngine; }
+    EqEngine getEqEngine() const { return eqEngine.load(); }
+
+    // tanh exato (padrão) ou aproximação de Padé (erro < 1e-4, opt-in) nos shapers do
+    // Drive/Telefy: parâmetro "SaturationMode", lido no snapshot de cada bloco
+    void setSaturationMode(SaturatorKernels::Mode newMode) { setConfigurationParameter("SaturationMode", (float)(int)newMode); }
+    SaturatorKernels::Mode getSaturationMode() const { return (SaturatorKernels::Mode)juce::roundToInt(parameters.saturationMode->load()); }
+
+    // Casamento de nível do auto-gain do Drive/Telefy: RMS ou K-weighted
+    // (parâmetro "AutoGainMode", lido no snapshot de cada bloco)
+    void setAutoGainMode(AutoGain::Mode newMode) { setConfigurationParameter("AutoGainMode", (float)(int)newMode); }
+    AutoGain::Mode getAutoGainMode() const { return (AutoGain::Mode)juce::roundToInt(parameters.autoGainMode->load()); }
+
+    // Oversampling dos estágios não lineares (Drive e Telefy): factorLog2 0..3 = 1x..8x.
+    // Mesmo efeito dos parâmetros "Oversampling"/"OversamplingFilter", mas aplicado na
+    // hora. Chamar do message thread: reconstrói os filtros e reporta a nova latência.
+    void setOversampling(int factorLog2, SaturatorOversampling::FilterMode filterMode);
+    // Render offline (bounce) usa 8x independente do fator ao vivo ("OfflineOversampling").
+    // Os dois ficam preparados e a latência reportada é a maior delas (o ao vivo atrasa até ela).
+    void setOfflineOversamplingEnabled(bool shouldUseHigherFactor);
+    int getOversamplingFactor() const { return driveOversampling.getFactor(); }
+
+    // EQ principal em fase linear (bandas + HPF/LPF como um FIR simétrico). lengthLog2
+    // escolhe o FIR (LinearPhaseEq::minLengthLog2..maxLengthLog2): mais longo = mais
+    // latência e mais precisão em graves. Mesmo efeito dos parâmetros "LinearPhase*",
+    // aplicado na hora. Chamar do message thread: reporta a latência.
+    void setLinearPhase(bool shouldBeEnabled, int lengthLog2 = LinearPhaseEq::defaultLengthLog2,
+                        LinearPhaseEq::Partitioning partitioning = LinearPhaseEq::Partitioning::NonUniform);
+    bool isLinearPhaseEnabled() const { return linearPhaseActive.load(std::memory_order_relaxed); }
+
+    void setNonRealtime(bool isNonRealtime) noexcept override;
+
+   #if TELEQ_ENABLE_PROFILING
+    // Custo por estágio do processBlock (painel de diagnóstico do editor)
+    StageProfiler& getProfiler() { return profiler; }
+   #endif
+
+    // Tamanho do sub-bloco (em amostras) em que os coeficientes são recalculados durante automação
+    void setCoefficientUpdateInterval(int numSamples);
+    int getCoefficientUpdateInterval() const { return coefficientUpdateInterval.load(std::memory_order_relaxed); }
+
+    // Um frame de medição (pico, RMS, timestamp) por bloco; só o editor consome
+    MeterFrameQueue& getMeterFrames() { return meterFrames; }
+
+    // Capturas do analisador de espectro (pré: depois do ganho de entrada; pós: saída)
+    SpectrumTap& getPreSpectrum() { return preSpectrum; }
+    SpectrumTap& getPostSpectrum() { return postSpectrum; }
+
+    // Coeficientes em uso (EQ + blend do Telefy) para a curva de resposta do editor
+    ResponseCurveSource& getResponseCurveSource() { return responseCurve; }
 
-    float getInputPeakL() const { return inputPeakL.load(); }
-    float getInputPeakR() const { return inputPeakR.load(); }
-    float getOutputPeakL() const { return outputPeakL.load(); }
-    float getOutputPeakR() const { return outputPeakR.load(); }
-    
 
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     juce::AudioProcessorValueTreeState apvts{ *this, nullptr,
         "Parameters", createParameterLayout() };
 
 private:
+    // Depois do apvts (ordem de declaração = ordem de construção)
+    ParameterHandles parameters{ apvts };
+
+    // Parâmetros de configuração (oversampling, fase linear) mudados pelo host ou pela UI:
+    // aplicados aqui, no message thread, pelo mesmo caminho do setStateInformation
+    void timerCallback() override;
+    void setConfigurationParameter(const juce::String& parameterID, float value);
+
     using Filter = juce::dsp::IIR::Filter<double>;
     using CutFilter = juce::dsp::ProcessorChain<Filter, Filter>;
     using TelefyChain = juce::dsp::ProcessorChain<juce::dsp::IIR::Filter<FilterCoefficientType>>;
 
+    // Espelha o estado de ativação derivado (HPF, LPF, Drive, Telefy) nos
+    // parâmetros *Active, via fila para o message thread
+    static constexpr size_t numActivationParameters = 4;
+    std::array<juce::RangedAudioParameter*, numActivationParameters> activationParameters{};
+    std::array<int, numActivationParameters> postedActivation{ -1, -1, -1, -1 };
+    std::atomic<bool> activationNeedsResync{ true };
+    ParameterNotificationQueue activationNotifications;
+    void postActivationStates(const ChainSettings& chainSettings);
+
+    // Núcleo comum dos dois processBlock (float converte para double, double roda in-place)
+    template <typename SampleType>
+    void processBlockInternal(juce::AudioBuffer<SampleType>& buffer);
+    void processChain(juce::AudioBuffer<FilterCoefficientType>& buffer, const ChainSettings& chainSettings);
+    void processEqAndTelefy(juce::AudioBuffer<FilterCoefficientType>& buffer, const ChainSettings& chainSettings);
+
+    // Caminho rápido quando o plugin inteiro é identidade
+    bool isNeutral(const ChainSettings& chainSettings) const;
+    template <typename SampleType>
+    void updateNeutralMeters(const juce::AudioBuffer<SampleType>& buffer);
+
+    // Pico e RMS dos dois primeiros canais (mono repete o canal único)
+    template <typename SampleType>
+    static void measureLevels(const juce::AudioBuffer<SampleType>& buffer,
+                              std::array<float, MeterFrame::numChannels>& peaks,
+                              std::array<float, MeterFrame::numChannels>& rmsLevels);
+    void pushMeterFrame() noexcept;
+
+    MeterFrameQueue meterFrames;
+    MeterFrame meterFrame; // frame do bloco atual (só o audio thread toca)
+
+    SpectrumTap preSpectrum, postSpectrum;
+
+    EqParameterSmoother eqSmoother;
+
+   #if TELEQ_ENABLE_PROFILING
+    StageProfiler profiler;
+   #endif
+    std::atomic<int> coefficientUpdateInterval{ 32 };
+
+    // Buffers de trabalho: dimensionados no prepareToPlay e reutilizados no processBlock
+    juce::AudioBuffer<FilterCoefficientType> doubleBuffer;
+    juce::AudioBuffer<FilterCoefficientType> telefyBuffer;
+    int scratchCapacity = 0;
+    void prepareScratchBuffers(int numChannels, int maxBlockSize);
 
+    juce::SmoothedValue<double> driveSmoothed;
 
-    // NOVO: Instncias da Chain Telefy
-    TelefyChain leftTelefyChain;
-    TelefyChain rightTelefyChain;
-    void updateFilterActivationStates();
-    void updateEffectActivationStates();
+    // Dispatch do saturador uma vez por bloco (cada modelo tem seu próprio laço)
+    void runDriveSaturator(int type, int slot, int channel, SaturatorKernels::Mode mode,
+                           const double* input, const double* gains, double* output, int numSamples);
+    void runTelefySaturator(int type, int slot, int channel, SaturatorKernels::Mode mode,
+                            const double* input, double gain, double* output, int numSamples);
+    void resetDriveFilters(int type);
 
-    std::vector<AutoGainRMS> autoGains;
-    std::vector<AutoGainRMS> telefyAutoGain;
-    juce::SmoothedValue<double> driveSmoothed;
+    SaturatorCrossfade driveCrossfade;
+    SaturatorCrossfade telefyCrossfade;
 
-    SaturatorFilters tapeFilters[3];
-    SaturatorFilters tubeFilters[2];
-    SaturatorFilters fetFilters[2];
+    // Saturador rodou no bloco anterior? Na volta (desligado -> ligado) os filtros
+    // e o oversampling são zerados em vez de devolver o último bloco de antes
+    bool driveEngaged = false, telefyDriveEngaged = false;
+
+    SaturatorOversampling driveOversampling;
+    SaturatorOversampling telefyOversampling;
+    void configureOversampling();
+    void reconfigureOversampling();
+
+    // Configuração lida dos parâmetros e a última aplicada: o
+    // reconfigure* só reconstrói quando as duas diferem
+    struct OversamplingConfig
+    {
+        int liveFactorLog2 = -1, offlineFactorLog2 = -1, filterMode = -1;
+
+        bool operator== (const OversamplingConfig& other) const noexcept
+        {
+            return liveFactorLog2 == other.liveFactorLog2 && offlineFactorLog2 == other.offlineFactorLog2
+                && filterMode == other.filterMode;
+        }
+    };
+
+    OversamplingConfig getOversamplingConfig() const;
+    OversamplingConfig appliedOversampling;
+
+    // Soma das latências (oversampling + FIR de fase linear) reportada ao host
+    void reportLatency();
+
+    // Atraso do processBlockBypassed, dimensionado pelo reportLatency
+    juce::AudioBuffer<double> bypassDelay;
+    int bypassDelayPosition = 0;
+    template <typename SampleType>
+    void processBlockBypassedInternal(juce::AudioBuffer<SampleType>& buffer);
+
+    // Rampa de pré-gain, saída do kernel atual e do kernel em fade-out
+    struct SaturatorScratch { enum { Gains, Wet, FadeOut, NumChannels }; };
+    juce::AudioBuffer<double> saturatorScratch;
     // ==============================================================================
 
 
@@ -183,7 +497,87 @@ private:
         Filter,     // 5: HighBand
         CutFilter>; // 6: LowPassCut
 
-    MonoChain leftChain, rightChain;
+    // Mesmos estágios do MonoChain nas cascatas de ordem fixa (sem o slot TelefyBandPass, sempre neutro)
+    struct EqStage
+    {
+        enum
+        {
+            HighPass0, HighPass1,
+            LowBand,
+            LowMidBand,
+            HighMidBand,
+            HighBand,
+            LowPass0, LowPass1,
+            NumStages
+        };
+    };
+
+    // Um LinkedEq por grupo de LinkedEq::numLanes canais consecutivos
+    using LinkedEq = LinkedBiquadCascade<EqStage::NumStages>;
+    std::vector<LinkedEq> linkedEq;
+    std::atomic<bool> channelLinkEnabled{ true };
+    bool isChannelLinked(int numChannels) const;
+
+    using FixedEq = FixedBiquadCascade<EqStage::NumStages>;
+
+    // Todo o estado por canal (EQ, Telefy, filtros dos saturadores, auto-gain) num
+    // único bloco contíguo, alocado no prepareToPlay para o layout atual
+    struct ChannelState
+    {
+        MonoChain eqChain;
+        FixedEq fixedEq;
+        TelefyChain telefyChain;
+        SaturatorFilters tapeFilters, tubeFilters, fetFilters;
+        AutoGain driveAutoGain, telefyAutoGain;
+    };
+
+    std::unique_ptr<ChannelState[]> channelStates;
+    int numChannelStates = 0;
+    void prepareChannelStates(int numChannels, double sampleRate, int maxBlockSize);
+
+    template <typename Function>
+    void forEachEqChain(Function&& function)
+    {
+        for (int ch = 0; ch < numChannelStates; ++ch)
+            function(channelStates[ch].eqChain);
+    }
+
+    std::atomic<EqEngine> eqEngine{ EqEngine::FixedTdf2 };
+    EqEngine activeEqEngine = EqEngine::FixedTdf2;
+    void resetEqState();
+
+    // Escreve o estágio nas cascatas de ordem fixa (agrupadas e por canal)
+    void setEqStageCoefficients(int stage, const BiquadDesign::Biquad& coefficients);
+    void setEqStageBypassed(int stage, bool shouldBeBypassed);
+
+    // Estágios da curva de resposta: os do EqStage e, por último, o blend do Telefy
+    static constexpr int telefyResponseStage = EqStage::NumStages;
+    ResponseCurveSource responseCurve{ EqStage::NumStages + 1 };
+
+    // Fase linear: projeta o FIR a partir dos estágios do EQ publicados acima.
+    // linearPhaseActive só muda com o processamento suspenso, mas o host e a UI
+    // também leem (getTailLengthSeconds, isLinearPhaseEnabled): atômicos.
+    LinearPhaseEq linearPhaseEq{ responseCurve, EqStage::NumStages };
+    std::atomic<bool> linearPhaseActive{ false };
+    std::atomic<int> linearPhaseTailSamples{ 0 };
+    void configureLinearPhase();
+    void reconfigureLinearPhase();
+
+    struct LinearPhaseConfig
+    {
+        bool enabled = false;
+        int lengthLog2 = -1, partitioning = -1;
+
+        bool operator== (const LinearPhaseConfig& other) const noexcept
+        {
+            // Desligado: comprimento e partição não importam
+            return enabled == other.enabled
+                && (!enabled || (lengthLog2 == other.lengthLog2 && partitioning == other.partitioning));
+        }
+    };
+
+    LinearPhaseConfig getLinearPhaseConfig() const;
+    LinearPhaseConfig appliedLinearPhase;
 
     enum ChainPositions
     {
@@ -198,6 +592,13 @@ private:
 
  
     void TeLeQAudioProcessor::updateFilters();
+    void updateFilters(const ChainSettings& chainSettings);
+
+    // Cache dos parâmetros aplicados no último bloco (recalculo por estágio)
+    ChainSettings lastFilterSettings;
+    std::atomic<bool> filtersNeedFullUpdate{ true };
+    bool telefyFilterNeedsUpdate = true;
+
     void updateLowCut(const ChainSettings& chainSettings);
 	void updateLowFilter(const ChainSettings& chainSettings);
     void updateLowMidFilter(const ChainSettings& chainSettings);
@@ -208,7 +609,8 @@ private:
     //void updateDrive(const ChainSettings& chainSettings);
 	//void updateInputOutputGains(const ChainSettings& chainSettings);
 	using Coefficients = Filter::CoefficientsPtr;
-	static void updateCoefficients(Coefficients& old, const Coefficients& replacements);
+	static void updateCoefficients(Filter& filter, const BiquadDesign::Biquad& replacements);
+    void prepareCoefficientStorage();
 
 	template<typename ChainType, typename CoefficientType>
     void updateCutFilter(ChainType& leftHighPass,
@@ -0,0 +1,49 @@
+/*
+  ==============================================================================
+
+    RealtimeGuard.cpp
+    Created: 12 Jan 2026 9:14:31pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "RealtimeGuard.h"
+
+#if TELEQ_RT_ALLOCATION_GUARD
+
+namespace
+{
+    // Profundidade de escopos ScopedNoAllocation ativos neste thread
+    thread_local int noAllocationDepth = 0;
+
+    std::atomic<int> numViolations{ 0 };
+}
+
+namespace RealtimeGuard
+{
+    ScopedNoAllocation::ScopedNoAllocation()  { ++noAllocationDepth; }
+    ScopedNoAllocation::~ScopedNoAllocation() { --noAllocationDepth; }
+
+    ScopedAllowAllocation::ScopedAllowAllocation()  : savedDepth(std::exchange(noAllocationDepth, 0)) {}
+    ScopedAllowAllocation::~ScopedAllowAllocation() { noAllocationDepth = savedDepth; }
+
+    void checkAllocationAllowed() noexcept
+    {
+        if (noAllocationDepth > 0)
+        {
+            // zera antes do jassert: o log da assercao tambem aloca
+            const auto saved = std::exchange(noAllocationDepth, 0);
+            numViolations.fetch_add(1, std::memory_order_relaxed);
+            jassertfalse; // alocacao no audio thread!
+            noAllocationDepth = saved;
+        }
+    }
+
+    int getNumViolations() noexcept
+    {
+        return numViolations.load(std::memory_order_relaxed);
+    }
+}
+
+#endif
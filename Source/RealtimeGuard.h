@@ -0,0 +1,61 @@
+/*
+  ==============================================================================
+
+    RealtimeGuard.h
+    Created: 12 Jan 2026 9:14:31pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// Guarda de debug: dispara jassert (e conta a violação) se o audio thread alocar
+// memoria dentro de um escopo ScopedNoAllocation. Em Release compila para nada.
+// Limitação: o plugin só marca os escopos; quem verifica é o hook de operator new
+// em RealtimeGuardAllocator.cpp, que apenas os executáveis (benchmark) compilam,
+// porque substituir o alocador global dentro do plugin interporia o do host. No
+// Debug do plugin rodando num DAW a guarda NÃO dispara: a verificação é feita
+// pelo TeLeQBenchmark, que liga TELEQ_RT_ALLOCATION_GUARD em todas as
+// configurações e reporta as alocações de cada cenário.
+#ifndef TELEQ_RT_ALLOCATION_GUARD
+ #define TELEQ_RT_ALLOCATION_GUARD JUCE_DEBUG
+#endif
+
+namespace RealtimeGuard
+{
+#if TELEQ_RT_ALLOCATION_GUARD
+    // Marca o thread atual como "proibido alocar" enquanto o objeto existir
+    struct ScopedNoAllocation
+    {
+        ScopedNoAllocation();
+        ~ScopedNoAllocation();
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedNoAllocation)
+    };
+
+    // Libera temporariamente a alocacao (trechos ainda nao real-time safe)
+    struct ScopedAllowAllocation
+    {
+        ScopedAllowAllocation();
+        ~ScopedAllowAllocation();
+
+    private:
+        int savedDepth = 0;
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedAllowAllocation)
+    };
+
+    // Chamado pelo hook de alocação: jassert se o thread atual está num escopo proibido
+    void checkAllocationAllowed() noexcept;
+
+    // Alocações em escopo proibido desde o início do processo (qualquer thread)
+    int getNumViolations() noexcept;
+#else
+    struct ScopedNoAllocation    { ScopedNoAllocation() {} };
+    struct ScopedAllowAllocation { ScopedAllowAllocation() {} };
+
+    inline int getNumViolations() noexcept { return 0; }
+#endif
+}
@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+    RealtimeGuardAllocator.cpp
+    Created: 17 Oct 2026 7:41:05pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+// Hook opcional da RealtimeGuard: substitui os operadores globais de alocação.
+// Só entra em executáveis próprios (benchmark); nunca no binário do plugin, onde
+// em ELF/macOS flat namespace interporia o alocador do host.
+
+#include "RealtimeGuard.h"
+
+#if TELEQ_RT_ALLOCATION_GUARD
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    void* guardedAllocate(std::size_t size)
+    {
+        RealtimeGuard::checkAllocationAllowed();
+
+        if (auto* ptr = std::malloc(size == 0 ? 1 : size))
+            return ptr;
+
+        throw std::bad_alloc();
+    }
+
+    void* guardedAllocateAligned(std::size_t size, std::align_val_t alignment)
+    {
+        RealtimeGuard::checkAllocationAllowed();
+
+        const auto align = juce::jmax((std::size_t)alignment, sizeof(void*));
+        const auto rounded = (juce::jmax(size, (std::size_t)1) + align - 1) / align * align;
+
+       #if JUCE_MSVC
+        auto* ptr = _aligned_malloc(rounded, align);
+       #else
+        auto* ptr = std::aligned_alloc(align, rounded);
+       #endif
+
+        if (ptr != nullptr)
+            return ptr;
+
+        throw std::bad_alloc();
+    }
+
+    void freeAligned(void* ptr) noexcept
+    {
+       #if JUCE_MSVC
+        _aligned_free(ptr);
+       #else
+        std::free(ptr);
+       #endif
+    }
+
+    template <typename Allocate>
+    void* allocateNoThrow(Allocate&& allocate) noexcept
+    {
+        try { return allocate(); }
+        catch (...) { return nullptr; }
+    }
+}
+
+void* operator new (std::size_t size)    { return guardedAllocate(size); }
+void* operator new[] (std::size_t size)  { return guardedAllocate(size); }
+void* operator new (std::size_t size, const std::nothrow_t&) noexcept   { return allocateNoThrow([size] { return guardedAllocate(size); }); }
+void* operator new[] (std::size_t size, const std::nothrow_t&) noexcept { return allocateNoThrow([size] { return guardedAllocate(size); }); }
+
+void* operator new (std::size_t size, std::align_val_t alignment)    { return guardedAllocateAligned(size, alignment); }
+void* operator new[] (std::size_t size, std::align_val_t alignment)  { return guardedAllocateAligned(size, alignment); }
+void* operator new (std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocateNoThrow([size, alignment] { return guardedAllocateAligned(size, alignment); });
+}
+void* operator new[] (std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocateNoThrow([size, alignment] { return guardedAllocateAligned(size, alignment); });
+}
+
+void operator delete (void* ptr) noexcept                          { std::free(ptr); }
+void operator delete[] (void* ptr) noexcept                        { std::free(ptr); }
+void operator delete (void* ptr, std::size_t) noexcept             { std::free(ptr); }
+void operator delete[] (void* ptr, std::size_t) noexcept           { std::free(ptr); }
+void operator delete (void* ptr, const std::nothrow_t&) noexcept   { std::free(ptr); }
+void operator delete[] (void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+void operator delete (void* ptr, std::align_val_t) noexcept                              { freeAligned(ptr); }
+void operator delete[] (void* ptr, std::align_val_t) noexcept                            { freeAligned(ptr); }
+void operator delete (void* ptr, std::size_t, std::align_val_t) noexcept                 { freeAligned(ptr); }
+void operator delete[] (void* ptr, std::size_t, std::align_val_t) noexcept               { freeAligned(ptr); }
+void operator delete (void* ptr, std::align_val_t, const std::nothrow_t&) noexcept       { freeAligned(ptr); }
+void operator delete[] (void* ptr, std::align_val_t, const std::nothrow_t&) noexcept     { freeAligned(ptr); }
+
+#endif
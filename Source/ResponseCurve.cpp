@@ -0,0 +1,278 @@
+/*
+  ==============================================================================
+
+    ResponseCurve.cpp
+    Created: 10 Mar 2026 8:55:17pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "ResponseCurve.h"
+
+ResponseCurveSource::ResponseCurveSource(int numStagesToUse)
+    : numStages(juce::jlimit(1, maxStages, numStagesToUse))
+{
+}
+
+void ResponseCurveSource::setSampleRate(double newSampleRate) noexcept
+{
+    sampleRate.store(newSampleRate, std::memory_order_release);
+}
+
+void ResponseCurveSource::setCoefficients(int stage, const BiquadDesign::Biquad& c) noexcept
+{
+    const auto& s = stages[(size_t)stage];
+
+    // Só o audio thread escreve: ler os próprios valores relaxed é seguro
+    if (s.b0.load(std::memory_order_relaxed) == c.b0 && s.b1.load(std::memory_order_relaxed) == c.b1
+        && s.b2.load(std::memory_order_relaxed) == c.b2 && s.a1.load(std::memory_order_relaxed) == c.a1
+        && s.a2.load(std::memory_order_relaxed) == c.a2)
+        return;
+
+    write(stage, [&c](Stage& target)
+    {
+        target.b0.store(c.b0, std::memory_order_relaxed);
+        target.b1.store(c.b1, std::memory_order_relaxed);
+        target.b2.store(c.b2, std::memory_order_relaxed);
+        target.a1.store(c.a1, std::memory_order_relaxed);
+        target.a2.store(c.a2, std::memory_order_relaxed);
+    });
+}
+
+void ResponseCurveSource::setEnabled(int stage, bool shouldBeEnabled) noexcept
+{
+    if (stages[(size_t)stage].enabled.load(std::memory_order_relaxed) == shouldBeEnabled)
+        return;
+
+    write(stage, [shouldBeEnabled](Stage& target) { target.enabled.store(shouldBeEnabled, std::memory_order_relaxed); });
+}
+
+void ResponseCurveSource::setMix(int stage, double mix, double gain) noexcept
+{
+    const auto& s = stages[(size_t)stage];
+
+    if (s.mix.load(std::memory_order_relaxed) == mix && s.gain.load(std::memory_order_relaxed) == gain)
+        return;
+
+    write(stage, [mix, gain](Stage& target)
+    {
+        target.mix.store(mix, std::memory_order_relaxed);
+        target.gain.store(gain, std::memory_order_relaxed);
+    });
+}
+
+juce::uint32 ResponseCurveSource::read(int stage, StageSnapshot& snapshot) const noexcept
+{
+    const auto& s = stages[(size_t)stage];
+
+    for (;;)
+    {
+        const auto before = s.sequence.load(std::memory_order_acquire);
+
+        if ((before & 1) != 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        snapshot.coefficients = { s.b0.load(std::memory_order_relaxed), s.b1.load(std::memory_order_relaxed),
+                                  s.b2.load(std::memory_order_relaxed), s.a1.load(std::memory_order_relaxed),
+                                  s.a2.load(std::memory_order_relaxed) };
+        snapshot.mix = s.mix.load(std::memory_order_relaxed);
+        snapshot.gain = s.gain.load(std::memory_order_relaxed);
+        snapshot.enabled = s.enabled.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (s.sequence.load(std::memory_order_relaxed) == before)
+            return before;
+    }
+}
+
+//==============================================================================
+ResponseCurveEngine::ResponseCurveEngine(ResponseCurveSource& sourceToUse, int numPoints)
+    : juce::Thread("TeLeQ Response Curve"),
+      source(sourceToUse),
+      numVectors(juce::jmax(1, (numPoints + (int)Vec::SIMDNumElements - 1) / (int)Vec::SIMDNumElements)),
+      stageResponses((size_t)sourceToUse.getNumStages())
+{
+    startThread(juce::Thread::Priority::low);
+}
+
+ResponseCurveEngine::~ResponseCurveEngine()
+{
+    stopThread(1000);
+}
+
+void ResponseCurveEngine::run()
+{
+    // Polling barato (um load por estágio): o audio thread não pode acordar threads
+    while (!threadShouldExit())
+    {
+        if (update())
+            publish();
+
+        wait(15);
+    }
+}
+
+bool ResponseCurveEngine::update()
+{
+    const double sampleRate = source.getSampleRate();
+    bool changed = false;
+
+    if (sampleRate != gridSampleRate)
+    {
+        prepareGrid(sampleRate);
+        changed = true;
+    }
+
+    for (int stage = 0; stage < source.getNumStages(); ++stage)
+    {
+        ResponseCurveSource::StageSnapshot snapshot;
+        const auto stageVersion = source.read(stage, snapshot);
+        auto& response = stageResponses[(size_t)stage];
+
+        if (response.valid && response.version == stageVersion)
+            continue;
+
+        computeStage(stage, snapshot);
+        response.version = stageVersion;
+        response.valid = true;
+        changed = true;
+    }
+
+    const bool neutral = source.isNeutral();
+    changed = changed || neutral != wasNeutral;
+    wasNeutral = neutral;
+
+    if (!changed)
+        return false;
+
+    // Produto complexo das respostas em cache (numeradores) e dos |D|^2
+    std::fill(totalReal.begin(), totalReal.end(), Vec::expand(1.0));
+    std::fill(totalImag.begin(), totalImag.end(), Vec::expand(0.0));
+    std::fill(totalNorm.begin(), totalNorm.end(), Vec::expand(1.0));
+
+    for (const auto& response : stageResponses)
+    {
+        if (neutral)
+            break;
+
+        for (int v = 0; v < numVectors; ++v)
+        {
+            const auto re = totalReal[(size_t)v] * response.real[(size_t)v] - totalImag[(size_t)v] * response.imag[(size_t)v];
+            const auto im = totalReal[(size_t)v] * response.imag[(size_t)v] + totalImag[(size_t)v] * response.real[(size_t)v];
+            totalReal[(size_t)v] = re;
+            totalImag[(size_t)v] = im;
+            totalNorm[(size_t)v] = totalNorm[(size_t)v] * response.norm[(size_t)v];
+        }
+    }
+
+    return true;
+}
+
+void ResponseCurveEngine::prepareGrid(double sampleRate)
+{
+    gridSampleRate = sampleRate;
+
+    const int lanes = (int)Vec::SIMDNumElements;
+    const int numPoints = numVectors * lanes;
+
+    for (auto* grid : { &cos1, &sin1, &cos2, &sin2, &totalReal, &totalImag, &totalNorm })
+        grid->assign((size_t)numVectors, Vec::expand(0.0));
+
+    for (int i = 0; i < numPoints; ++i)
+    {
+        const double proportion = numPoints > 1 ? (double)i / (numPoints - 1) : 0.0;
+        const double frequency = minFrequency * std::pow((double)maxFrequency / minFrequency, proportion);
+        const double omega = juce::jmin(juce::MathConstants<double>::pi,
+                                        juce::MathConstants<double>::twoPi * frequency / sampleRate);
+
+        const auto v = (size_t)(i / lanes);
+        const auto lane = (size_t)(i % lanes);
+        cos1[v].set(lane, std::cos(omega));
+        sin1[v].set(lane, std::sin(omega));
+        cos2[v].set(lane, std::cos(2.0 * omega));
+        sin2[v].set(lane, std::sin(2.0 * omega));
+    }
+
+    // Grade nova: toda resposta em cache fica inválida
+    for (auto& response : stageResponses)
+    {
+        response.real.assign((size_t)numVectors, Vec::expand(1.0));
+        response.imag.assign((size_t)numVectors, Vec::expand(0.0));
+        response.norm.assign((size_t)numVectors, Vec::expand(1.0));
+        response.valid = false;
+    }
+}
+
+void ResponseCurveEngine::computeStage(int stage, const ResponseCurveSource::StageSnapshot& snapshot)
+{
+    auto& response = stageResponses[(size_t)stage];
+
+    if (!snapshot.enabled)
+    {
+        std::fill(response.real.begin(), response.real.end(), Vec::expand(1.0));
+        std::fill(response.imag.begin(), response.imag.end(), Vec::expand(0.0));
+        std::fill(response.norm.begin(), response.norm.end(), Vec::expand(1.0));
+        return;
+    }
+
+    const auto& c = snapshot.coefficients;
+    const auto b0 = Vec::expand(c.b0), b1 = Vec::expand(c.b1), b2 = Vec::expand(c.b2);
+    const auto a1 = Vec::expand(c.a1), a2 = Vec::expand(c.a2);
+    const auto one = Vec::expand(1.0);
+    const auto dry = Vec::expand(snapshot.gain * (1.0 - snapshot.mix));
+    const auto wet = Vec::expand(snapshot.gain * snapshot.mix);
+
+    for (size_t v = 0; v < (size_t)numVectors; ++v)
+    {
+        // H(e^jw) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2), z^-k = cos kw - j sen kw
+        const auto numReal = b0 + b1 * cos1[v] + b2 * cos2[v];
+        const auto numImag = Vec::expand(0.0) - (b1 * sin1[v] + b2 * sin2[v]);
+        const auto denReal = one + a1 * cos1[v] + a2 * cos2[v];
+        const auto denImag = Vec::expand(0.0) - (a1 * sin1[v] + a2 * sin2[v]);
+
+        // H = N conj(D) / |D|^2: guarda o numerador complexo e |D|^2 separados
+        // (sem divisão no laço; a divisão é uma só por ponto, no publish)
+        const auto denNorm = denReal * denReal + denImag * denImag;
+        const auto nConjDReal = numReal * denReal + numImag * denImag;
+        const auto nConjDImag = numImag * denReal - numReal * denImag;
+
+        // gain * ((1 - mix) + mix * H), multiplicado por |D|^2
+        response.real[v] = dry * denNorm + wet * nConjDReal;
+        response.imag[v] = wet * nConjDImag;
+        response.norm[v] = denNorm;
+    }
+}
+
+void ResponseCurveEngine::publish()
+{
+    const int lanes = (int)Vec::SIMDNumElements;
+    const int numPoints = numVectors * lanes;
+
+    auto newPath = std::make_shared<juce::Path>();
+    newPath->preallocateSpace(numPoints * 3);
+
+    for (int i = 0; i < numPoints; ++i)
+    {
+        const auto v = (size_t)(i / lanes);
+        const auto lane = (size_t)(i % lanes);
+        const double re = totalReal[v].get(lane);
+        const double im = totalImag[v].get(lane);
+        const double norm = totalNorm[v].get(lane);
+
+        const float x = numPoints > 1 ? (float)i / (float)(numPoints - 1) : 0.0f;
+        const float decibels = (float)juce::Decibels::gainToDecibels(std::sqrt(re * re + im * im) / norm, -120.0);
+
+        if (i == 0)
+            newPath->startNewSubPath(x, decibels);
+        else
+            newPath->lineTo(x, decibels);
+    }
+
+    std::atomic_store(&path, std::shared_ptr<const juce::Path>(std::move(newPath)));
+    version.fetch_add(1, std::memory_order_release);
+}
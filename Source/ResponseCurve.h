@@ -0,0 +1,133 @@
+/*
+  ==============================================================================
+
+    ResponseCurve.h
+    Created: 10 Mar 2026 8:55:17pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "BiquadDesign.h"
+
+// Coeficientes em uso, publicados pelo audio thread para a curva de resposta.
+// Cada estágio é H(z) = gain * ((1 - mix) + mix * B(z)): os estágios do EQ têm
+// mix = gain = 1; o Telefy é um blend paralelo com o band-pass. Cada estágio tem
+// um seqlock: o escritor nunca espera e só escreve quando algo mudou.
+class ResponseCurveSource
+{
+public:
+    static constexpr int maxStages = 16;
+
+    explicit ResponseCurveSource(int numStagesToUse);
+
+    int getNumStages() const noexcept { return numStages; }
+
+    void setSampleRate(double newSampleRate) noexcept;
+    double getSampleRate() const noexcept { return sampleRate.load(std::memory_order_acquire); }
+
+    // ===== Audio thread =====
+    void setCoefficients(int stage, const BiquadDesign::Biquad& coefficients) noexcept;
+    void setEnabled(int stage, bool shouldBeEnabled) noexcept;
+    void setMix(int stage, double mix, double gain) noexcept;
+
+    // Plugin inteiro neutro (o processBlock pula os filtros): curva plana sem
+    // tocar nos estágios, que continuam válidos para quando o EQ voltar
+    void setNeutral(bool isNeutral) noexcept { neutral.store(isNeutral, std::memory_order_release); }
+    bool isNeutral() const noexcept { return neutral.load(std::memory_order_acquire); }
+
+    // ===== Leitor =====
+    struct StageSnapshot
+    {
+        BiquadDesign::Biquad coefficients;
+        double mix = 1.0, gain = 1.0;
+        bool enabled = true;
+    };
+
+    // Retorna a versão do estágio (muda a cada escrita)
+    juce::uint32 read(int stage, StageSnapshot& snapshot) const noexcept;
+
+private:
+    struct Stage
+    {
+        std::atomic<juce::uint32> sequence{ 0 };
+        std::atomic<double> b0{ 1.0 }, b1{ 0.0 }, b2{ 0.0 }, a1{ 0.0 }, a2{ 0.0 };
+        std::atomic<double> mix{ 1.0 }, gain{ 1.0 };
+        std::atomic<bool> enabled{ true };
+    };
+
+    template <typename Function>
+    void write(int stage, Function&& function) noexcept
+    {
+        jassert(juce::isPositiveAndBelow(stage, numStages));
+        auto& s = stages[(size_t)stage];
+
+        // Ímpar = escrita em andamento
+        const auto sequence = s.sequence.load(std::memory_order_relaxed);
+        s.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        function(s);
+
+        s.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    std::array<Stage, maxStages> stages;
+    const int numStages;
+    std::atomic<double> sampleRate{ 44100.0 };
+    std::atomic<bool> neutral{ false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ResponseCurveSource)
+};
+
+//==============================================================================
+// Magnitude da cascata inteira em numPoints frequências log (20 Hz .. 20 kHz),
+// calculada num thread de background. A resposta complexa de cada estágio fica
+// em cache e só é recalculada quando o seqlock daquele estágio muda; o laço por
+// frequência roda em juce::dsp::SIMDRegister<double>. O editor recebe um
+// juce::Path imutável por troca atômica de ponteiro (x em 0..1, y em dB).
+class ResponseCurveEngine : private juce::Thread
+{
+public:
+    static constexpr float minFrequency = 20.0f, maxFrequency = 20000.0f;
+
+    explicit ResponseCurveEngine(ResponseCurveSource& sourceToUse, int numPoints = 256);
+    ~ResponseCurveEngine() override;
+
+    std::shared_ptr<const juce::Path> getPath() const noexcept { return std::atomic_load(&path); }
+    juce::uint32 getVersion() const noexcept { return version.load(std::memory_order_acquire); }
+
+private:
+    using Vec = juce::dsp::SIMDRegister<double>;
+
+    void run() override;
+    bool update();
+    void prepareGrid(double sampleRate);
+    void computeStage(int stage, const ResponseCurveSource::StageSnapshot& snapshot);
+    void publish();
+
+    ResponseCurveSource& source;
+    const int numVectors;
+
+    // z^-1 e z^-2 em cada frequência (cos/sen de w e 2w), numVectors * lanes pontos
+    std::vector<Vec> cos1, sin1, cos2, sin2;
+
+    struct StageResponse
+    {
+        std::vector<Vec> real, imag, norm;  // resposta = (real + j imag) / norm
+        juce::uint32 version = 0;
+        bool valid = false;
+    };
+
+    std::vector<StageResponse> stageResponses;
+    std::vector<Vec> totalReal, totalImag, totalNorm;
+    double gridSampleRate = 0.0;
+    bool wasNeutral = false;
+
+    std::shared_ptr<const juce::Path> path;
+    std::atomic<juce::uint32> version{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ResponseCurveEngine)
+};
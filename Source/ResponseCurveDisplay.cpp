@@ -0,0 +1,45 @@
+/*
+  ==============================================================================
+
+    ResponseCurveDisplay.cpp
+    Created: 10 Mar 2026 8:55:17pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "ResponseCurveDisplay.h"
+
+ResponseCurveDisplay::ResponseCurveDisplay(ResponseCurveSource& source)
+    : engine(source)
+{
+    setOpaque(false);
+    setInterceptsMouseClicks(false, false);
+}
+
+void ResponseCurveDisplay::update()
+{
+    const auto version = engine.getVersion();
+
+    if (version == pathVersion || !isShowing())
+        return;
+
+    pathVersion = version;
+    path = engine.getPath();
+    repaint();
+}
+
+void ResponseCurveDisplay::paint(juce::Graphics& g)
+{
+    if (path == nullptr || path->isEmpty())
+        return;
+
+    // x: 0..1 (log de 20 Hz a 20 kHz); y: dB, 0 dB no meio
+    const auto bounds = getLocalBounds().toFloat().reduced(0.0f, 2.0f);
+    const auto transform = juce::AffineTransform::scale(bounds.getWidth(), -bounds.getHeight() * 0.5f / rangeDb)
+                               .translated(bounds.getX(), bounds.getCentreY());
+
+    g.reduceClipRegion(getLocalBounds());
+    g.setColour(juce::Colours::white.withAlpha(0.75f));
+    g.strokePath(*path, juce::PathStrokeType(1.5f, juce::PathStrokeType::curved, juce::PathStrokeType::rounded), transform);
+}
@@ -0,0 +1,37 @@
+/*
+  ==============================================================================
+
+    ResponseCurveDisplay.h
+    Created: 10 Mar 2026 8:55:17pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "ResponseCurve.h"
+
+// Curva de resposta do EQ por cima do espectro. Não calcula nada: no vblank só
+// confere a versão do ResponseCurveEngine e, se mudou, pega o path novo e
+// repinta. Não recebe cliques (o menu do analisador fica por baixo).
+class ResponseCurveDisplay : public juce::Component
+{
+public:
+    explicit ResponseCurveDisplay(ResponseCurveSource& source);
+
+    void paint(juce::Graphics& g) override;
+
+private:
+    void update();
+
+    static constexpr float rangeDb = 24.0f; // ±
+
+    ResponseCurveEngine engine;
+    std::shared_ptr<const juce::Path> path;
+    juce::uint32 pathVersion = 0;
+
+    juce::VBlankAttachment vBlank{ this, [this] { update(); } };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ResponseCurveDisplay)
+};
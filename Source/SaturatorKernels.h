@@ -0,0 +1,124 @@
+/*
+  ==============================================================================
+
+    SaturatorKernels.h
+    Created: 16 Feb 2026 9:27:40pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <cmath>
+
+// Waveshapers do Drive e do Telefy como kernels de bloco sem estado. Os filtros
+// de pré/de-ênfase rodam em passes separados (ver runDriveModel no processor),
+// então o laço do shaper não tem dependência serial e o compilador vetoriza.
+namespace SaturatorKernels
+{
+    enum class Mode
+    {
+        Exact,  // std::tanh
+        Fast    // Padé [7/6]
+    };
+
+    struct ExactTanh
+    {
+        static double tanh(double x) noexcept { return std::tanh(x); }
+    };
+
+    // Aproximante de Padé [7/6] de tanh com a entrada limitada a ±4.97.
+    // Erro absoluto < 1e-4 (~ -80 dB) em toda a reta e |saída| <= 1.
+    // Sem ramos (o clamp vira min/max), então vetoriza junto com o shaper.
+    struct FastTanh
+    {
+        static double tanh(double x) noexcept
+        {
+            x = juce::jlimit(-4.97, 4.97, x);
+            const double x2 = x * x;
+            const double num = x * (135135.0 + x2 * (17325.0 + x2 * (378.0 + x2)));
+            const double den = 135135.0 + x2 * (62370.0 + x2 * (3150.0 + x2 * 28.0));
+            return num / den;
+        }
+    };
+
+    // ===== Drive =====
+    // Tape: SoftClipper assimétrico
+    template <typename Tanh>
+    struct Tape
+    {
+        double operator()(double x) const noexcept
+        {
+            const double a = x + 0.04 * x * x;
+            return Tanh::tanh(a * 0.9);
+        }
+    };
+
+    // Tube: modelo polinomial de tríodo
+    template <typename Tanh>
+    struct Tube
+    {
+        double operator()(double x) const noexcept
+        {
+            const double x2 = x * x;
+            const double x4 = x2 * x2;
+            const double nonlin = 0.85 * x + 0.15 * x2 + 0.04 * x4;
+            return Tanh::tanh(nonlin * 1.1);
+        }
+    };
+
+    // FET: soft-knee racional (não usa tanh)
+    template <typename Tanh>
+    struct Fet
+    {
+        double operator()(double x) const noexcept
+        {
+            const double a = x + 0.03 * x * x;
+            return a / (1.0 + 0.55 * std::abs(a));
+        }
+    };
+
+    // ===== Telefy =====
+    // FET+ (hiper agressivo): assimetria forte, soft-knee e topo arredondado
+    template <typename Tanh>
+    struct FetPlus
+    {
+        double operator()(double x) const noexcept
+        {
+            const double a = x + 0.10 * x * x;
+            const double knee = a / (1.0 + 0.35 * std::abs(a));
+            return Tanh::tanh(knee * 1.5);
+        }
+    };
+
+    // Rasp (AM clipping / telefonização distorcida)
+    template <typename Tanh>
+    struct Rasp
+    {
+        double operator()(double x) const noexcept
+        {
+            const double a = x + 0.12 * x * x;
+            const double b = Tanh::tanh(a * 2.4);
+            return 0.7 * b + 0.3 * (b * b);
+        }
+    };
+
+    //==============================================================================
+    template <typename Shaper>
+    inline void applyBlock(Shaper shaper, double* data, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+            data[i] = shaper(data[i]);
+    }
+
+    // O modo é escolhido uma vez por bloco; cada combinação shaper/tanh tem seu laço
+    template <template <typename> class Shaper>
+    inline void apply(double* data, int numSamples, Mode mode) noexcept
+    {
+        if (mode == Mode::Fast)
+            applyBlock(Shaper<FastTanh>{}, data, numSamples);
+        else
+            applyBlock(Shaper<ExactTanh>{}, data, numSamples);
+    }
+}
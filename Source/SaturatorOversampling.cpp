@@ -0,0 +1,145 @@
+/*
+  ==============================================================================
+
+    SaturatorOversampling.cpp
+    Created: 23 Feb 2026 8:12:55pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "SaturatorOversampling.h"
+
+void SaturatorOversampling::prepare(int numChannels, int maxBlockSize, int liveFactorLog2, int offlineFactorLog2, FilterMode mode)
+{
+    numChannels = juce::jmax(1, numChannels);
+    liveFactorLog2 = juce::jlimit(0, maxFactorLog2, liveFactorLog2);
+    offlineFactorLog2 = juce::jlimit(0, maxFactorLog2, offlineFactorLog2);
+
+    hasOfflineConfig = offlineFactorLog2 != liveFactorLog2;
+
+    prepareConfig(configs[Live], numChannels, maxBlockSize, liveFactorLog2, mode);
+    prepareConfig(configs[Offline], numChannels, maxBlockSize, hasOfflineConfig ? offlineFactorLog2 : 0, mode);
+
+    // Latência comum: a configuração mais rápida completa com atraso
+    auto getOversamplerLatency = [](const Config& config)
+    {
+        return config.oversamplers.empty() ? 0 : juce::roundToInt(config.oversamplers.front()->getLatencyInSamples());
+    };
+
+    const int liveLatency = getOversamplerLatency(configs[Live]);
+    const int offlineLatency = hasOfflineConfig ? getOversamplerLatency(configs[Offline]) : liveLatency;
+    latency = juce::jmax(liveLatency, offlineLatency);
+
+    for (auto* config : { &configs[Live], &configs[Offline] })
+    {
+        config->padding = config == &configs[Live] ? latency - liveLatency : latency - offlineLatency;
+
+        const size_t numLines = config->padding > 0 ? (size_t)(numChannels * numSlots) : 0;
+        config->paddingLines.assign(numLines, std::vector<double>((size_t)juce::jmax(1, config->padding), 0.0));
+        config->paddingPositions.assign(numLines, 0);
+    }
+
+    delayLines.assign((size_t)numChannels, std::vector<double>((size_t)juce::jmax(1, latency), 0.0));
+    delayPositions.assign((size_t)numChannels, 0);
+
+    activeConfig = hasOfflineConfig && offlineRequested.load(std::memory_order_relaxed) ? Offline : Live;
+}
+
+void SaturatorOversampling::prepareConfig(Config& config, int numChannels, int maxBlockSize, int factorLog2, FilterMode mode)
+{
+    config.factorLog2 = factorLog2;
+    config.oversamplers.clear();
+
+    if (factorLog2 == 0)
+        return;
+
+    const auto filterType = mode == FilterMode::LinearPhaseFir
+        ? juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple
+        : juce::dsp::Oversampling<double>::filterHalfBandPolyphaseIIR;
+
+    for (int i = 0; i < numChannels * numSlots; ++i)
+    {
+        // useIntegerLatency: a latência reportada ao host precisa ser inteira
+        auto oversampler = std::make_unique<juce::dsp::Oversampling<double>>(1, (size_t)factorLog2, filterType, true, true);
+        oversampler->initProcessing((size_t)maxBlockSize);
+        config.oversamplers.push_back(std::move(oversampler));
+    }
+}
+
+void SaturatorOversampling::beginBlock() noexcept
+{
+    const int requested = hasOfflineConfig && offlineRequested.load(std::memory_order_relaxed) ? Offline : Live;
+
+    if (requested == activeConfig)
+        return;
+
+    // A configuração que entra estava parada: não herda estado antigo
+    resetConfig(configs[(size_t)requested]);
+    activeConfig = requested;
+}
+
+void SaturatorOversampling::reset()
+{
+    for (auto& config : configs)
+        resetConfig(config);
+
+    for (auto& line : delayLines)
+        std::fill(line.begin(), line.end(), 0.0);
+
+    std::fill(delayPositions.begin(), delayPositions.end(), 0);
+}
+
+void SaturatorOversampling::resetConfig(Config& config)
+{
+    for (auto& oversampler : config.oversamplers)
+        oversampler->reset();
+
+    for (auto& line : config.paddingLines)
+        std::fill(line.begin(), line.end(), 0.0);
+
+    std::fill(config.paddingPositions.begin(), config.paddingPositions.end(), 0);
+}
+
+void SaturatorOversampling::resetSlot(int slot)
+{
+    auto& config = configs[(size_t)activeConfig];
+
+    for (size_t i = (size_t)slot; i < config.oversamplers.size(); i += numSlots)
+        config.oversamplers[i]->reset();
+
+    for (size_t i = (size_t)slot; i < config.paddingLines.size(); i += numSlots)
+    {
+        std::fill(config.paddingLines[i].begin(), config.paddingLines[i].end(), 0.0);
+        config.paddingPositions[i] = 0;
+    }
+}
+
+void SaturatorOversampling::processDelay(int channel, double* data, int numSamples, bool replace) noexcept
+{
+    if (latency == 0 || !juce::isPositiveAndBelow(channel, (int)delayLines.size()))
+        return;
+
+    runDelay(delayLines[(size_t)channel], delayPositions[(size_t)channel], data, numSamples, replace);
+}
+
+void SaturatorOversampling::runDelay(std::vector<double>& line, int& position, double* data, int numSamples, bool replace) noexcept
+{
+    const int length = (int)line.size();
+    auto* samples = line.data();
+    int pos = position;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const double delayed = samples[pos];
+        samples[pos] = data[i];
+
+        if (replace)
+            data[i] = delayed;
+
+        if (++pos == length)
+            pos = 0;
+    }
+
+    position = pos;
+}
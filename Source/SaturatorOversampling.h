@@ -0,0 +1,111 @@
+/*
+  ==============================================================================
+
+    SaturatorOversampling.h
+    Created: 23 Feb 2026 8:12:55pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// Oversampling só em volta do shaper não linear (Drive e Telefy), nunca do EQ.
+// Cada canal tem dois slots independentes para o crossfade entre modelos de
+// saturação (o modelo novo entra no slot livre, com o estado zerado).
+// O fator ao vivo e o do render offline ficam preparados juntos; a troca é só
+// um flag atômico, e o de menor latência é atrasado até a do outro, para que a
+// latência reportada não mude entre os dois.
+class SaturatorOversampling
+{
+public:
+    enum class FilterMode
+    {
+        PolyphaseIir,   // baixa latência (fase não linear)
+        LinearPhaseFir  // fase linear, mais latência
+    };
+
+    static constexpr int numSlots = 2;
+    static constexpr int maxFactorLog2 = 3; // 8x
+
+    // Aloca tudo (chamar fora do audio thread). factorLog2 = 0 desliga o oversampling.
+    void prepare(int numChannels, int maxBlockSize, int liveFactorLog2, int offlineFactorLog2, FilterMode mode);
+    void reset();
+    void resetSlot(int slot);
+
+    // Pode vir de qualquer thread (inclusive de dentro do callback): só guarda o pedido
+    void setRenderingOffline(bool isOffline) noexcept { offlineRequested.store(isOffline, std::memory_order_relaxed); }
+
+    // Audio thread, uma vez por bloco antes de process/processDelay: aplica o
+    // pedido do setRenderingOffline (a configuração que entra começa zerada)
+    void beginBlock() noexcept;
+
+    int getFactor() const noexcept { return 1 << configs[Live].factorLog2; }
+
+    // Latência inteira introduzida pelo up/down (a mesma nas duas configurações)
+    int getLatencyInSamples() const noexcept { return latency; }
+
+    // Sobe a amostragem, aplica kernel(double*, int) na taxa alta e desce, no lugar
+    template <typename Kernel>
+    void process(int channel, int slot, double* data, int numSamples, Kernel&& kernel)
+    {
+        auto& config = configs[(size_t)activeConfig];
+        const size_t index = (size_t)(channel * numSlots + slot);
+
+        if (config.factorLog2 == 0)
+        {
+            kernel(data, numSamples);
+        }
+        else
+        {
+            auto& oversampler = *config.oversamplers[index];
+
+            double* channels[] = { data };
+            juce::dsp::AudioBlock<double> block(channels, 1, (size_t)numSamples);
+
+            auto upsampled = oversampler.processSamplesUp(block);
+            kernel(upsampled.getChannelPointer(0), (int)upsampled.getNumSamples());
+            oversampler.processSamplesDown(block);
+        }
+
+        if (config.padding > 0)
+            runDelay(config.paddingLines[index], config.paddingPositions[index], data, numSamples, true);
+    }
+
+    // Atraso igual à latência, para o sinal que não passa pelo shaper. É
+    // alimentado em todo bloco (replace = false só empurra), para que ligar ou
+    // desligar o estágio não cause salto de tempo.
+    void processDelay(int channel, double* data, int numSamples, bool replace) noexcept;
+
+private:
+    enum { Live, Offline, NumConfigs };
+
+    struct Config
+    {
+        std::vector<std::unique_ptr<juce::dsp::Oversampling<double>>> oversamplers;
+        int factorLog2 = 0;
+
+        // Atraso extra até a latência comum, por canal e slot
+        int padding = 0;
+        std::vector<std::vector<double>> paddingLines;
+        std::vector<int> paddingPositions;
+    };
+
+    static void prepareConfig(Config& config, int numChannels, int maxBlockSize, int factorLog2, FilterMode mode);
+    static void resetConfig(Config& config);
+
+    // Linha de atraso circular (o tamanho da linha é o atraso)
+    static void runDelay(std::vector<double>& line, int& position, double* data, int numSamples, bool replace) noexcept;
+
+    std::array<Config, NumConfigs> configs;
+    std::atomic<bool> offlineRequested{ false };
+    int activeConfig = Live;
+    bool hasOfflineConfig = false; // false: o offline usa o mesmo fator do ao vivo
+
+    // Linha de atraso circular por canal (latency amostras)
+    std::vector<std::vector<double>> delayLines;
+    std::vector<int> delayPositions;
+
+    int latency = 0;
+};
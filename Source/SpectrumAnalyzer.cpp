@@ -0,0 +1,201 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyzer.cpp
+    Created: 8 Mar 2026 7:41:26pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "SpectrumAnalyzer.h"
+
+SpectrumTap::SpectrumTap(int capacity)
+    : fifo(capacity), samples((size_t)capacity)
+{
+}
+
+int SpectrumTap::read(float* destination, int maxSamples) noexcept
+{
+    const auto scope = fifo.read(juce::jmin(maxSamples, fifo.getNumReady()));
+
+    if (scope.blockSize1 > 0)
+        std::copy_n(samples.data() + scope.startIndex1, scope.blockSize1, destination);
+
+    if (scope.blockSize2 > 0)
+        std::copy_n(samples.data() + scope.startIndex2, scope.blockSize2, destination + scope.blockSize1);
+
+    return scope.blockSize1 + scope.blockSize2;
+}
+
+void SpectrumTap::discardPending() noexcept
+{
+    fifo.read(fifo.getNumReady());
+}
+
+//==============================================================================
+SpectrumAnalyzer::SpectrumAnalyzer(SpectrumTap& preTap, SpectrumTap& postTap)
+    : juce::Thread("TeLeQ Spectrum")
+{
+    channels[Pre].tap = &preTap;
+    channels[Post].tap = &postTap;
+
+    lastRequestTime = juce::Time::getMillisecondCounter();
+    startThread(juce::Thread::Priority::low);
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer()
+{
+    stopThread(1000);
+
+    for (auto& channel : channels)
+        channel.tap->setEnabled(false);
+}
+
+void SpectrumAnalyzer::setFftOrder(int newOrder) noexcept
+{
+    fftOrder = juce::jlimit(minFftOrder, maxFftOrder, newOrder);
+    settingsChanged = true;
+}
+
+void SpectrumAnalyzer::setOverlap(int newOverlapFactor) noexcept
+{
+    overlap = juce::jlimit(1, 8, newOverlapFactor);
+    settingsChanged = true;
+}
+
+bool SpectrumAnalyzer::copySpectrum(Source source, Spectrum& destination)
+{
+    lastRequestTime = juce::Time::getMillisecondCounter();
+
+    auto& channel = channels[(size_t)source];
+    const juce::ScopedLock sl(channel.lock);
+
+    if (channel.version == destination.version)
+        return false;
+
+    destination.decibels = channel.published;
+    destination.fftSize = channel.publishedFftSize;
+    destination.sampleRate = channel.publishedSampleRate;
+    destination.version = channel.version;
+    return true;
+}
+
+void SpectrumAnalyzer::configure()
+{
+    settingsChanged = false;
+
+    const int order = fftOrder.load();
+    fftSize = 1 << order;
+    hopSize = juce::jmax(1, fftSize / overlap.load());
+
+    fft = std::make_unique<juce::dsp::FFT>(order);
+    window = std::make_unique<juce::dsp::WindowingFunction<float>>((size_t)fftSize, juce::dsp::WindowingFunction<float>::hann, false);
+
+    // Senoide em fundo de escala -> 0 dB (ganho coerente da Hann = 0.5)
+    magnitudeToGain = 2.0f / (0.5f * (float)fftSize);
+
+    for (auto& channel : channels)
+    {
+        channel.history.assign((size_t)fftSize, 0.0f);
+        channel.fftData.assign((size_t)fftSize * 2, 0.0f);
+        channel.smoothed.assign((size_t)fftSize / 2 + 1, floorDb);
+        channel.readScratch.resize((size_t)fftSize);
+        channel.writePosition = 0;
+        channel.samplesSinceTransform = 0;
+        channel.hasSpectrum = false;
+    }
+}
+
+void SpectrumAnalyzer::run()
+{
+    bool active = false;
+
+    while (!threadShouldExit())
+    {
+        // Editor fechado ou escondido: o audio thread para de copiar amostras
+        const bool requested = juce::Time::getMillisecondCounter() - lastRequestTime.load() < idleTimeoutMs;
+
+        if (requested != active)
+        {
+            active = requested;
+
+            for (auto& channel : channels)
+            {
+                channel.tap->setEnabled(active);
+                channel.tap->discardPending();
+            }
+        }
+
+        if (!active)
+        {
+            wait(100);
+            continue;
+        }
+
+        if (settingsChanged)
+            configure();
+
+        bool didWork = false;
+
+        for (int source = 0; source < NumSources; ++source)
+            didWork = processSource(source) || didWork;
+
+        if (!didWork)
+            wait(5);
+    }
+}
+
+bool SpectrumAnalyzer::processSource(int source)
+{
+    auto& channel = channels[(size_t)source];
+    const int numRead = channel.tap->read(channel.readScratch.data(), hopSize - channel.samplesSinceTransform);
+
+    for (int i = 0; i < numRead; ++i)
+    {
+        channel.history[(size_t)channel.writePosition] = channel.readScratch[(size_t)i];
+        channel.writePosition = (channel.writePosition + 1) % fftSize;
+    }
+
+    channel.samplesSinceTransform += numRead;
+
+    if (channel.samplesSinceTransform < hopSize)
+        return numRead > 0;
+
+    channel.samplesSinceTransform = 0;
+
+    // Janela na ordem temporal (o mais antigo em writePosition)
+    const int tailLength = fftSize - channel.writePosition;
+    std::copy_n(channel.history.data() + channel.writePosition, tailLength, channel.fftData.data());
+    std::copy_n(channel.history.data(), channel.writePosition, channel.fftData.data() + tailLength);
+    std::fill(channel.fftData.begin() + fftSize, channel.fftData.end(), 0.0f);
+
+    window->multiplyWithWindowingTable(channel.fftData.data(), (size_t)fftSize);
+    fft->performFrequencyOnlyForwardTransform(channel.fftData.data(), true);
+
+    // Suavização balística por bin: sobe rápido, desce devagar
+    const double sampleRate = channel.tap->getSampleRate();
+    const double hopSeconds = hopSize / sampleRate;
+    const float attack = (float)(1.0 - std::exp(-hopSeconds / 0.01));
+    const float release = (float)(1.0 - std::exp(-hopSeconds / 0.25));
+
+    for (size_t bin = 0; bin < channel.smoothed.size(); ++bin)
+    {
+        const float level = juce::Decibels::gainToDecibels(channel.fftData[bin] * magnitudeToGain, floorDb);
+        auto& smoothed = channel.smoothed[bin];
+
+        if (!channel.hasSpectrum)
+            smoothed = level;
+        else
+            smoothed += (level - smoothed) * (level > smoothed ? attack : release);
+    }
+
+    channel.hasSpectrum = true;
+
+    const juce::ScopedLock sl(channel.lock);
+    channel.published = channel.smoothed;
+    channel.publishedFftSize = fftSize;
+    channel.publishedSampleRate = sampleRate;
+    ++channel.version;
+    return true;
+}
@@ -0,0 +1,145 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyzer.h
+    Created: 8 Mar 2026 7:41:26pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// Ponto de captura do analisador no processor (pré ou pós). O audio thread só
+// copia a média dos canais para uma FIFO SPSC lock-free, e só enquanto algum
+// analisador estiver lendo (editor aberto e visível); desligado custa um load atômico.
+class SpectrumTap
+{
+public:
+    explicit SpectrumTap(int capacity = 1 << 15);
+
+    void setSampleRate(double newSampleRate) noexcept { sampleRate.store(newSampleRate, std::memory_order_relaxed); }
+    double getSampleRate() const noexcept { return sampleRate.load(std::memory_order_relaxed); }
+
+    // ===== Audio thread =====
+    template <typename SampleType>
+    void push(const juce::AudioBuffer<SampleType>& buffer) noexcept
+    {
+        if (!enabled.load(std::memory_order_relaxed) || buffer.getNumChannels() == 0)
+            return;
+
+        const int numChannels = buffer.getNumChannels();
+        const auto* const* channels = buffer.getArrayOfReadPointers();
+        const float channelGain = 1.0f / (float)numChannels;
+
+        // FIFO cheia (analisador atrasado): o resto do bloco é descartado
+        const auto scope = fifo.write(buffer.getNumSamples());
+
+        auto downmix = [&](int start, int count, int sourceOffset)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                float sum = 0.0f;
+
+                for (int ch = 0; ch < numChannels; ++ch)
+                    sum += (float)channels[ch][sourceOffset + i];
+
+                samples[(size_t)(start + i)] = sum * channelGain;
+            }
+        };
+
+        downmix(scope.startIndex1, scope.blockSize1, 0);
+        downmix(scope.startIndex2, scope.blockSize2, scope.blockSize1);
+    }
+
+    // ===== Thread do analisador =====
+    void setEnabled(bool shouldBeEnabled) noexcept { enabled.store(shouldBeEnabled, std::memory_order_relaxed); }
+    int read(float* destination, int maxSamples) noexcept;
+    void discardPending() noexcept;
+
+private:
+    juce::AbstractFifo fifo;
+    std::vector<float> samples;
+    std::atomic<bool> enabled{ false };
+    std::atomic<double> sampleRate{ 44100.0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumTap)
+};
+
+//==============================================================================
+// FFT janelada (Hann) e suavização em background para os dois pontos de captura.
+// O editor lê o espectro mais recente (dB por bin) e desenha; quando ninguém lê
+// por um tempo (editor escondido) o thread desliga as capturas e dorme.
+class SpectrumAnalyzer : private juce::Thread
+{
+public:
+    enum Source
+    {
+        Pre,
+        Post,
+        NumSources
+    };
+
+    static constexpr int minFftOrder = 10, maxFftOrder = 14;
+    static constexpr float floorDb = -120.0f;
+
+    SpectrumAnalyzer(SpectrumTap& preTap, SpectrumTap& postTap);
+    ~SpectrumAnalyzer() override;
+
+    // Aplicados pelo thread do analisador no próximo ciclo
+    void setFftOrder(int newOrder) noexcept;
+    void setOverlap(int newOverlapFactor) noexcept;
+    int getFftOrder() const noexcept { return fftOrder.load(); }
+    int getOverlap() const noexcept { return overlap.load(); }
+
+    struct Spectrum
+    {
+        std::vector<float> decibels;  // fftSize / 2 + 1 bins
+        int fftSize = 0;
+        double sampleRate = 44100.0;
+        juce::uint32 version = 0;
+    };
+
+    // Message thread: copia o espectro se mudou desde a última cópia (version)
+    bool copySpectrum(Source source, Spectrum& destination);
+
+private:
+    void run() override;
+    void configure();
+    bool processSource(int source);
+
+    struct Channel
+    {
+        SpectrumTap* tap = nullptr;
+        std::vector<float> history;    // últimas fftSize amostras (circular)
+        std::vector<float> fftData;    // 2 * fftSize (exigido pela juce::dsp::FFT)
+        std::vector<float> smoothed;   // dB por bin
+        std::vector<float> readScratch;
+        int writePosition = 0;
+        int samplesSinceTransform = 0;
+        bool hasSpectrum = false;
+
+        juce::CriticalSection lock;    // só entre o analisador e o message thread
+        std::vector<float> published;
+        juce::uint32 version = 0;
+        int publishedFftSize = 0;
+        double publishedSampleRate = 44100.0;
+    };
+
+    std::array<Channel, NumSources> channels;
+
+    std::unique_ptr<juce::dsp::FFT> fft;
+    std::unique_ptr<juce::dsp::WindowingFunction<float>> window;
+    float magnitudeToGain = 1.0f;
+    int fftSize = 0, hopSize = 0;
+
+    std::atomic<int> fftOrder{ 12 }, overlap{ 4 };
+    std::atomic<bool> settingsChanged{ true };
+
+    // Último pedido do editor (ms): sem pedidos, o analisador para
+    std::atomic<juce::uint32> lastRequestTime{ 0 };
+    static constexpr juce::uint32 idleTimeoutMs = 500;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumAnalyzer)
+};
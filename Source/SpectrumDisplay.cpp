@@ -0,0 +1,134 @@
+/*
+  ==============================================================================
+
+    SpectrumDisplay.cpp
+    Created: 8 Mar 2026 7:41:26pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "SpectrumDisplay.h"
+
+SpectrumDisplay::SpectrumDisplay(SpectrumTap& preTap, SpectrumTap& postTap)
+    : analyzer(preTap, postTap)
+{
+    setOpaque(false);
+}
+
+void SpectrumDisplay::update()
+{
+    if (!isShowing())
+        return;
+
+    bool changed = false;
+
+    for (int source = 0; source < SpectrumAnalyzer::NumSources; ++source)
+        changed = analyzer.copySpectrum((SpectrumAnalyzer::Source)source, spectra[(size_t)source]) || changed;
+
+    if (!changed)
+        return;
+
+    prePath = createPath(spectra[SpectrumAnalyzer::Pre]);
+    postPath = createPath(spectra[SpectrumAnalyzer::Post]);
+    repaint();
+}
+
+juce::Path SpectrumDisplay::createPath(const SpectrumAnalyzer::Spectrum& spectrum) const
+{
+    juce::Path path;
+    const auto& decibels = spectrum.decibels;
+
+    if (decibels.size() < 2 || spectrum.fftSize == 0 || getWidth() <= 0)
+        return path;
+
+    const float width = (float)getWidth();
+    const float height = (float)getHeight();
+    const float binsPerHz = (float)spectrum.fftSize / (float)spectrum.sampleRate;
+    const int lastBin = (int)decibels.size() - 1;
+
+    auto frequencyAtX = [width](float x)
+    {
+        return minFrequency * std::pow(maxFrequency / minFrequency, x / width);
+    };
+
+    for (int x = 0; x <= getWidth(); x += pixelsPerPoint)
+    {
+        // Agudos: vários bins por ponto (pega o maior); graves: interpola entre dois bins
+        const float firstBin = frequencyAtX((float)x) * binsPerHz;
+        const float endBin = frequencyAtX((float)(x + pixelsPerPoint)) * binsPerHz;
+        float level = SpectrumAnalyzer::floorDb;
+
+        if (endBin - firstBin >= 1.0f)
+        {
+            for (int bin = (int)firstBin; bin < juce::jmin((int)endBin, lastBin + 1); ++bin)
+                level = juce::jmax(level, decibels[(size_t)bin]);
+        }
+        else
+        {
+            const int bin = juce::jmin((int)firstBin, lastBin - 1);
+            const float fraction = juce::jlimit(0.0f, 1.0f, firstBin - (float)bin);
+            level = decibels[(size_t)bin] + (decibels[(size_t)bin + 1] - decibels[(size_t)bin]) * fraction;
+        }
+
+        const float y = juce::jmap(juce::jlimit(minDb, maxDb, level), minDb, maxDb, height, 0.0f);
+
+        if (x == 0)
+            path.startNewSubPath((float)x, y);
+        else
+            path.lineTo((float)x, y);
+    }
+
+    return path;
+}
+
+void SpectrumDisplay::paint(juce::Graphics& g)
+{
+    if (!prePath.isEmpty())
+    {
+        // Pré: área preenchida até a base
+        auto filled = prePath;
+        filled.lineTo(prePath.getCurrentPosition().withY((float)getHeight()));
+        filled.lineTo(0.0f, (float)getHeight());
+        filled.closeSubPath();
+
+        g.setColour(juce::Colours::white.withAlpha(0.06f));
+        g.fillPath(filled);
+    }
+
+    if (!postPath.isEmpty())
+    {
+        g.setColour(juce::Colour(0xFF4DB6AC).withAlpha(0.55f));
+        g.strokePath(postPath, juce::PathStrokeType(1.2f, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
+    }
+}
+
+void SpectrumDisplay::resized()
+{
+    prePath = createPath(spectra[SpectrumAnalyzer::Pre]);
+    postPath = createPath(spectra[SpectrumAnalyzer::Post]);
+}
+
+void SpectrumDisplay::mouseDown(const juce::MouseEvent& event)
+{
+    if (event.mods.isPopupMenu())
+        showSettingsMenu();
+}
+
+void SpectrumDisplay::showSettingsMenu()
+{
+    juce::PopupMenu fftMenu, overlapMenu;
+
+    for (int order = SpectrumAnalyzer::minFftOrder; order <= SpectrumAnalyzer::maxFftOrder; ++order)
+        fftMenu.addItem(juce::String(1 << order), true, analyzer.getFftOrder() == order,
+                        [this, order] { analyzer.setFftOrder(order); });
+
+    for (int factor : { 1, 2, 4, 8 })
+        overlapMenu.addItem(juce::String(factor) + "x", true, analyzer.getOverlap() == factor,
+                            [this, factor] { analyzer.setOverlap(factor); });
+
+    juce::PopupMenu menu;
+    menu.addSubMenu("FFT Size", fftMenu);
+    menu.addSubMenu("Overlap", overlapMenu);
+    menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(this));
+}
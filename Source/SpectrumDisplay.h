@@ -0,0 +1,44 @@
+/*
+  ==============================================================================
+
+    SpectrumDisplay.h
+    Created: 8 Mar 2026 7:41:26pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "SpectrumAnalyzer.h"
+
+// Espectro pré (preenchido, discreto) e pós (linha) atrás do EQ. Redesenha no
+// vblank só quando chega espectro novo; o path é decimado em frequência
+// logarítmica (um ponto a cada poucos pixels). Clique direito: tamanho da FFT
+// e overlap.
+class SpectrumDisplay : public juce::Component
+{
+public:
+    SpectrumDisplay(SpectrumTap& preTap, SpectrumTap& postTap);
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+    void mouseDown(const juce::MouseEvent& event) override;
+
+private:
+    void update();
+    juce::Path createPath(const SpectrumAnalyzer::Spectrum& spectrum) const;
+    void showSettingsMenu();
+
+    static constexpr float minFrequency = 20.0f, maxFrequency = 20000.0f;
+    static constexpr float minDb = -90.0f, maxDb = 6.0f;
+    static constexpr int pixelsPerPoint = 3;
+
+    SpectrumAnalyzer analyzer;
+    std::array<SpectrumAnalyzer::Spectrum, SpectrumAnalyzer::NumSources> spectra;
+    juce::Path prePath, postPath;
+
+    juce::VBlankAttachment vBlank{ this, [this] { update(); } };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumDisplay)
+};
@@ -0,0 +1,158 @@
+/*
+  ==============================================================================
+
+    StageProfiler.cpp
+    Created: 25 Feb 2026 8:47:12pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#include "StageProfiler.h"
+
+const char* StageProfiler::getStageName(int stage) noexcept
+{
+    switch (stage)
+    {
+    case Input:  return "Input";
+    case Drive:  return "Drive";
+    case Eq:     return "EQ";
+    case Telefy: return "Telefy";
+    case Output: return "Output";
+    case Total:  return "Total";
+    default:     return "";
+    }
+}
+
+void StageProfiler::prepare(double newSampleRate) noexcept
+{
+    sampleRate.store(newSampleRate, std::memory_order_relaxed);
+    referenceCounter.store(readCounter(), std::memory_order_relaxed);
+    referenceTicks.store(juce::Time::getHighResolutionTicks(), std::memory_order_relaxed);
+    requestReset();
+}
+
+void StageProfiler::endBlock() noexcept
+{
+    const auto now = readCounter();
+    blockCosts[Total] = now - blockStart;
+
+    if (resetRequested.exchange(false, std::memory_order_relaxed))
+    {
+        for (auto& stage : counters)
+        {
+            stage.sum.store(0, std::memory_order_relaxed);
+            stage.max.store(0, std::memory_order_relaxed);
+
+            for (auto& bucket : stage.histogram)
+                bucket.store(0, std::memory_order_relaxed);
+        }
+
+        numBlocks.store(0, std::memory_order_relaxed);
+        numSamples.store(0, std::memory_order_relaxed);
+    }
+
+    // Único escritor: load + store em vez de read-modify-write (sem lock no barramento)
+    for (size_t i = 0; i < counters.size(); ++i)
+    {
+        auto& stage = counters[i];
+        const auto cost = blockCosts[i];
+
+        stage.sum.store(stage.sum.load(std::memory_order_relaxed) + cost, std::memory_order_relaxed);
+
+        if (cost > stage.max.load(std::memory_order_relaxed))
+            stage.max.store(cost, std::memory_order_relaxed);
+
+        auto& bucket = stage.histogram[(size_t)getBucket(cost)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    numSamples.store(numSamples.load(std::memory_order_relaxed) + (juce::uint64)blockSamples, std::memory_order_relaxed);
+    numBlocks.store(numBlocks.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+StageProfiler::Stats StageProfiler::getStats(int stage) const noexcept
+{
+    Stats stats;
+
+    const auto blocks = numBlocks.load(std::memory_order_acquire);
+    const double countsPerSecond = getCountsPerSecond();
+
+    if (blocks == 0 || countsPerSecond <= 0.0 || !juce::isPositiveAndBelow(stage, (int)NumStages))
+        return stats;
+
+    const auto& counter = counters[(size_t)stage];
+    const double toMicroseconds = 1.0e6 / countsPerSecond;
+
+    stats.numBlocks = blocks;
+    stats.meanMicroseconds = (double)counter.sum.load(std::memory_order_relaxed) / (double)blocks * toMicroseconds;
+    stats.maxMicroseconds = (double)counter.max.load(std::memory_order_relaxed) * toMicroseconds;
+
+    // p99: primeiro bucket em que o acumulado passa de 99% dos blocos
+    juce::uint64 histogramTotal = 0;
+    for (const auto& bucket : counter.histogram)
+        histogramTotal += bucket.load(std::memory_order_relaxed);
+
+    const auto target = (histogramTotal * 99 + 99) / 100;
+    juce::uint64 accumulated = 0;
+
+    for (int i = 0; i < numBuckets; ++i)
+    {
+        accumulated += counter.histogram[(size_t)i].load(std::memory_order_relaxed);
+
+        if (accumulated >= target)
+        {
+            stats.p99Microseconds = juce::jmin((double)getBucketUpperBound(i) * toMicroseconds, stats.maxMicroseconds);
+            break;
+        }
+    }
+
+    const double meanBlockSeconds = (double)numSamples.load(std::memory_order_relaxed)
+                                  / (double)blocks / sampleRate.load(std::memory_order_relaxed);
+
+    if (meanBlockSeconds > 0.0)
+        stats.deadlineRatio = stats.meanMicroseconds * 1.0e-6 / meanBlockSeconds;
+
+    return stats;
+}
+
+double StageProfiler::getCountsPerSecond() const noexcept
+{
+   #if JUCE_INTEL
+    const auto elapsedTicks = juce::Time::getHighResolutionTicks() - referenceTicks.load(std::memory_order_relaxed);
+    const double elapsedSeconds = juce::Time::highResolutionTicksToSeconds(elapsedTicks);
+
+    // Precisa de alguns ms desde o prepare para a razão ser estável
+    if (elapsedSeconds < 0.01)
+        return 0.0;
+
+    return (double)(readCounter() - referenceCounter.load(std::memory_order_relaxed)) / elapsedSeconds;
+   #else
+    return (double)juce::Time::getHighResolutionTicksPerSecond();
+   #endif
+}
+
+int StageProfiler::getBucket(juce::uint64 counts) noexcept
+{
+    if (counts < 4)
+        return (int)counts;
+
+    const auto high = (juce::uint32)(counts >> 32);
+    const int msb = high != 0 ? 32 + juce::findHighestSetBit(high)
+                              : juce::findHighestSetBit((juce::uint32)counts);
+
+    // Oitava (msb) e os 2 bits seguintes
+    return msb * 4 + (int)((counts >> (msb - 2)) & 3);
+}
+
+juce::uint64 StageProfiler::getBucketUpperBound(int bucket) noexcept
+{
+    if (bucket < 4)
+        return (juce::uint64)bucket + 1;
+
+    if (bucket >= numBuckets - 1)
+        return std::numeric_limits<juce::uint64>::max();
+
+    // Limite inferior do bucket seguinte dentro da mesma oitava
+    return (juce::uint64)(4 + bucket % 4 + 1) << (bucket / 4 - 2);
+}
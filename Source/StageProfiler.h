@@ -0,0 +1,128 @@
+/*
+  ==============================================================================
+
+    StageProfiler.h
+    Created: 25 Feb 2026 8:47:12pm
+    Author:  Dill
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+#if JUCE_INTEL
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <x86intrin.h>
+ #endif
+#endif
+
+// Build "no-instrumentation" define TELEQ_ENABLE_PROFILING=0: os contadores e o
+// painel de diagnóstico somem do binário
+#ifndef TELEQ_ENABLE_PROFILING
+ #define TELEQ_ENABLE_PROFILING 1
+#endif
+
+#if TELEQ_ENABLE_PROFILING
+ #define TELEQ_PROFILE(statement) statement
+#else
+ #define TELEQ_PROFILE(statement)
+#endif
+
+// Custo por bloco de cada estágio do processBlock, medido com o TSC (rdtsc no
+// x86: clock nominal constante, não ciclos do núcleo) ou os ticks de alta
+// resolução nos outros; a taxa é calibrada contra o relógio no prepare. O audio thread é o
+// único escritor: cada lap() soma o tempo desde a marca anterior ao estágio e o
+// endBlock() publica em estatísticas atômicas (soma, máximo e histograma log),
+// que o message thread lê sem trava.
+class StageProfiler
+{
+public:
+    enum Stage
+    {
+        Input,   // conversão float -> double, ganho de entrada e meters
+        Drive,
+        Eq,      // coeficientes + MonoChain / cascatas
+        Telefy,
+        Output,  // ganho de saída, meters e conversão de volta
+        Total,   // bloco inteiro
+        NumStages
+    };
+
+    static const char* getStageName(int stage) noexcept;
+
+    struct Stats
+    {
+        double meanMicroseconds = 0.0;
+        double p99Microseconds = 0.0;
+        double maxMicroseconds = 0.0;
+        double deadlineRatio = 0.0;  // custo médio / duração média do bloco
+        juce::uint64 numBlocks = 0;
+    };
+
+    // Chamar no prepareToPlay (referência para converter o contador em segundos)
+    void prepare(double sampleRate) noexcept;
+
+    // ===== Audio thread =====
+    void startBlock(int numSamples) noexcept
+    {
+        blockSamples = numSamples;
+        blockCosts.fill(0);
+        blockStart = lastMark = readCounter();
+    }
+
+    void lap(Stage stage) noexcept
+    {
+        const auto now = readCounter();
+        blockCosts[(size_t)stage] += now - lastMark;
+        lastMark = now;
+    }
+
+    void endBlock() noexcept;
+
+    // ===== Message thread =====
+    Stats getStats(int stage) const noexcept;
+    void requestReset() noexcept { resetRequested.store(true, std::memory_order_relaxed); }
+
+private:
+    static juce::uint64 readCounter() noexcept
+    {
+       #if JUCE_INTEL
+        return (juce::uint64)__rdtsc();
+       #else
+        return (juce::uint64)juce::Time::getHighResolutionTicks();
+       #endif
+    }
+
+    // Taxa do contador, medida contra o relógio de alta resolução desde o prepare
+    double getCountsPerSecond() const noexcept;
+
+    // 4 buckets por oitava: ~19% de resolução no p99
+    static constexpr int numBuckets = 256;
+    static int getBucket(juce::uint64 counts) noexcept;
+    static juce::uint64 getBucketUpperBound(int bucket) noexcept;
+
+    struct StageCounters
+    {
+        std::atomic<juce::uint64> sum{ 0 }, max{ 0 };
+        std::array<std::atomic<juce::uint32>, numBuckets> histogram{};
+    };
+
+    std::array<StageCounters, NumStages> counters;
+    std::atomic<juce::uint64> numBlocks{ 0 }, numSamples{ 0 };
+    std::atomic<bool> resetRequested{ false };
+
+    // Estado do bloco atual (só o audio thread toca)
+    std::array<juce::uint64, NumStages> blockCosts{};
+    juce::uint64 blockStart = 0, lastMark = 0;
+    int blockSamples = 0;
+
+    // Calibração do contador (escrita no prepare)
+    std::atomic<double> sampleRate{ 44100.0 };
+    std::atomic<juce::uint64> referenceCounter{ 0 };
+    std::atomic<juce::int64> referenceTicks{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StageProfiler)
+};